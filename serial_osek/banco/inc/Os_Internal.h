@@ -0,0 +1,81 @@
+/* Copyright 2026, Gustavo Sosa - UTN FRT
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef OS_INTERNAL_H    /*! @cond    */
+#define OS_INTERNAL_H    /*! @endcond */
+
+/** @file Os_Internal.h
+ **
+ ** @brief Sustituto de las definiciones internas de FreeOSEK para el banco de pruebas
+ **
+ ** Declara la tabla con la descripción constante de cada tarea que FreeOSEK
+ ** genera a partir del archivo OIL, con los campos que usa el proyecto.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2026.10.14 | gsosa       | Version inicial del archivo             |
+ **
+ ** @addtogroup ejemplos
+ ** @{
+ */
+
+/* === Inclusiones de archivos externos ==================================== */
+#include <stdint.h>
+#include "os.h"
+
+/* === Cabecera C++ ======================================================== */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros ================================================= */
+
+/* == Declaraciones de tipos de datos ====================================== */
+
+typedef struct {
+   uint8_t * StackPtr;           /** < Inicio de la memoria de la pila */
+   uint32_t StackSize;           /** < Tamaño de la pila en bytes */
+} TaskConstType;
+
+/* === Declaraciones de variables externas ================================= */
+
+extern const TaskConstType TasksConst[TASKS_COUNT];
+
+/* === Declaraciones de funciones externas ================================= */
+
+/* === Ciere de documentacion ============================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* OS_INTERNAL_H */
@@ -0,0 +1,99 @@
+/* Copyright 2026, Gustavo Sosa - UTN FRT
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SERIAL_CFG_H    /*! @cond    */
+#define SERIAL_CFG_H    /*! @endcond */
+
+/** @file Serial_Cfg.h
+ **
+ ** @brief Sustituto de la configuración generada para el banco de pruebas
+ **
+ ** Tiene el mismo contenido que genera FreeOSEK a partir de
+ ** gen/inc/Serial_Cfg.h.php y de serial_osek.oil, por lo que se debe
+ ** actualizar cuando cambian las rutinas de servicio, los eventos o las
+ ** alarmas del OIL.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  2 | 2026.10.14 | gsosa       | Aviso del coprocesador Cortex-M0        |
+ ** |  1 | 2026.10.14 | gsosa       | Version inicial del archivo             |
+ **
+ ** @addtogroup ejemplos
+ ** @{
+ */
+
+/* === Definicion y Macros ================================================= */
+
+//! Puerto CONSOLA atendido por la rutina EventoSerial
+#define SERIAL_CFG_CONSOLA    1
+#define SERIAL_CFG_CONSOLA_UART       LPC_USART2
+#define SERIAL_CFG_CONSOLA_IRQ        USART2_IRQn
+#define SERIAL_CFG_CONSOLA_RELOJ      CLK_APB2_UART2
+#define SERIAL_CFG_CONSOLA_DMA        GPDMA_CONN_UART2_Tx
+#define SERIAL_CFG_CONSOLA_PRIORIDAD  4
+#define SERIAL_CFG_CONSOLA_TAREA      Recepcion
+#define SERIAL_CFG_CONSOLA_EVENTO     Recibido
+
+//! Puerto RS485 atendido por la rutina EventoRs485
+#define SERIAL_CFG_RS485    1
+#define SERIAL_CFG_RS485_UART       LPC_USART0
+#define SERIAL_CFG_RS485_IRQ        USART0_IRQn
+#define SERIAL_CFG_RS485_RELOJ      CLK_APB0_UART0
+#define SERIAL_CFG_RS485_DMA        GPDMA_CONN_UART0_Tx
+#define SERIAL_CFG_RS485_PRIORIDAD  4
+#define SERIAL_CFG_RS485_TAREA      Recepcion
+#define SERIAL_CFG_RS485_EVENTO     RecibidoRs485
+
+//! Puerto RS232 atendido por la rutina EventoRs232
+#define SERIAL_CFG_RS232    1
+#define SERIAL_CFG_RS232_UART       LPC_USART3
+#define SERIAL_CFG_RS232_IRQ        USART3_IRQn
+#define SERIAL_CFG_RS232_RELOJ      CLK_APB2_UART3
+#define SERIAL_CFG_RS232_DMA        GPDMA_CONN_UART3_Tx
+#define SERIAL_CFG_RS232_PRIORIDAD  4
+#define SERIAL_CFG_RS232_TAREA      Recepcion
+#define SERIAL_CFG_RS232_EVENTO     RecibidoRs232
+
+//! Prioridad de la rutina de servicio del DMA, cero si no esta declarada
+#define SERIAL_CFG_DMA_PRIORIDAD    4
+
+//! Indica si el OIL declara la alarma Agrupar
+#define SERIAL_CFG_AGRUPAR          1
+
+//! Indica si el OIL declara la rutina EventoCoprocesador del aviso del M0
+#define SERIAL_CFG_COPROCESADOR     1
+#define SERIAL_CFG_COPROCESADOR_PRIORIDAD  4
+
+/* === Ciere de documentacion ============================================== */
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* SERIAL_CFG_H */
@@ -0,0 +1,249 @@
+/* Copyright 2026, Gustavo Sosa - UTN FRT
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CHIP_H    /*! @cond    */
+#define CHIP_H    /*! @endcond */
+
+/** @file chip.h
+ **
+ ** @brief Sustituto de LPCOpen para el banco de pruebas
+ **
+ ** Declara el subconjunto de la biblioteca LPCOpen que usa el proyecto con los
+ ** mismos nombres, para compilar los fuentes en la computadora. Los periféricos
+ ** los implementa simulador.c.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2026.10.14 | gsosa       | Version inicial del archivo             |
+ **
+ ** @addtogroup ejemplos
+ ** @{
+ */
+
+/* === Inclusiones de archivos externos ==================================== */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Cabecera C++ ======================================================== */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros ================================================= */
+
+#define TRUE                  1
+#define FALSE                 0
+
+//! Uarts simuladas, solo USB_UART transmite datos
+#define LPC_USART0            (&uart_simulada[0])
+#define LPC_UART1             (&uart_simulada[1])
+#define LPC_USART2            (&uart_simulada[2])
+#define LPC_USART3            (&uart_simulada[3])
+
+#define UART_IER_RBRINT       (1 << 0)
+#define UART_IER_THREINT      (1 << 1)
+#define UART_IER_RLSINT       (1 << 2)
+
+#define UART_IIR_INTSTAT_PEND (1 << 0)
+#define UART_IIR_INTID_MASK   (7 << 1)
+#define UART_IIR_INTID_RLS    (3 << 1)
+#define UART_IIR_INTID_RDA    (2 << 1)
+#define UART_IIR_INTID_CTI    (6 << 1)
+#define UART_IIR_INTID_THRE   (1 << 1)
+
+#define UART_LSR_RDR          (1 << 0)
+#define UART_LSR_OE           (1 << 1)
+#define UART_LSR_PE           (1 << 2)
+#define UART_LSR_FE           (1 << 3)
+#define UART_LSR_BI           (1 << 4)
+#define UART_LSR_THRE         (1 << 5)
+#define UART_LSR_TEMT         (1 << 6)
+#define UART_LSR_RXFE         (1 << 7)
+
+#define UART_FCR_FIFO_EN      (1 << 0)
+#define UART_FCR_RX_RS        (1 << 1)
+#define UART_FCR_TX_RS        (1 << 2)
+#define UART_FCR_DMAMODE_SEL  (1 << 3)
+#define UART_FCR_TRG_LEV0     (0)
+#define UART_FCR_TRG_LEV1     (1 << 6)
+#define UART_FCR_TRG_LEV2     (2 << 6)
+#define UART_FCR_TRG_LEV3     (3 << 6)
+
+#define UART_LCR_WLEN8        (3 << 0)
+#define UART_LCR_SBS_1BIT     (0 << 2)
+#define UART_LCR_PARITY_DIS   (0 << 3)
+#define UART_LCR_DLAB_EN      (1 << 7)
+
+#define UART_FDR_DIVADDVAL(n) ((n) & 0x0F)
+#define UART_FDR_MULVAL(n)    (((n) << 4) & 0xF0)
+
+#define UART_RS485CTRL_DCTRL_EN (1 << 4)
+#define UART_RS485CTRL_OINV_1 (1 << 5)
+
+//! Modos y funciones de los pines, la multiplexión no se simula
+#define MD_PUP                (0x0 << 3)
+#define MD_PLN                (0x2 << 3)
+#define MD_PDN                (0x3 << 3)
+#define MD_EZI                (0x1 << 6)
+#define MD_ZI                 (0x1 << 7)
+#define FUNC2                 0x2
+#define FUNC7                 0x7
+
+#define LPC_GPIO_PIN_INT      (&pinint_simulado)
+#define PININTCH(canal)       (1 << (canal))
+
+#define LPC_GPDMA             (&gpdma_simulado)
+
+#define GPDMA_CONN_UART0_Tx   9
+#define GPDMA_CONN_UART1_Tx   11
+#define GPDMA_CONN_UART2_Tx   13
+#define GPDMA_CONN_UART3_Tx   15
+
+//! El contador de ciclos sigue al tiempo simulado
+#define DWT                   (&dwt_simulado)
+#define CoreDebug             (&coredebug_simulado)
+#define CoreDebug_DEMCR_TRCENA_Msk (1UL << 24)
+#define DWT_CTRL_CYCCNTENA_Msk (1UL)
+
+#define __DMB()               __asm__ volatile("" ::: "memory")
+#define __WFI()               ((void) 0)
+
+/* == Declaraciones de tipos de datos ====================================== */
+
+typedef enum { ERROR = 0, SUCCESS = 1 } Status;
+
+typedef struct {
+   volatile uint32_t THR, RBR, IER, IIR, FCR, LCR, MCR, LSR, DLL, DLM, FDR, TER;
+} LPC_USART_T;
+
+typedef struct {
+   volatile uint32_t ISEL, IENR, SIENR, CIENR, IENF, SIENF, CIENF, RISE, FALL, IST;
+} LPC_PIN_INT_T;
+
+typedef struct {
+   uint32_t reservado;
+} LPC_GPDMA_T;
+
+typedef enum {
+   GPDMA_TRANSFERTYPE_M2P_CONTROLLER_DMA = 1,
+} GPDMA_FLOW_CONTROL_T;
+
+typedef struct {
+   uint32_t src, dst, lli, ctrl;
+} DMA_TransferDescriptor_t;
+
+typedef enum {
+   DMA_IRQn = 2,
+   USART0_IRQn = 24,
+   UART1_IRQn = 25,
+   USART2_IRQn = 26,
+   USART3_IRQn = 27,
+} IRQn_Type;
+
+typedef struct {
+   volatile uint32_t CTRL, CYCCNT;
+} DWT_Type;
+
+typedef struct {
+   volatile uint32_t DEMCR;
+} CoreDebug_Type;
+
+//! Relojes base de las uarts, todos siguen al reloj del procesador
+typedef enum {
+   CLK_APB0_UART0,
+   CLK_APB0_UART1,
+   CLK_APB2_UART2,
+   CLK_APB2_UART3,
+} CHIP_CCU_CLK_T;
+
+/* === Declaraciones de variables externas ================================= */
+
+//! Frecuencia del procesador, la fija la configuración de la simulación
+extern uint32_t SystemCoreClock;
+
+extern LPC_USART_T uart_simulada[4];
+extern LPC_PIN_INT_T pinint_simulado;
+extern LPC_GPDMA_T gpdma_simulado;
+extern DWT_Type dwt_simulado;
+extern CoreDebug_Type coredebug_simulado;
+
+/* === Declaraciones de funciones externas ================================= */
+
+void Chip_UART_SendByte(LPC_USART_T * uart, uint8_t dato);
+uint8_t Chip_UART_ReadByte(LPC_USART_T * uart);
+void Chip_UART_IntEnable(LPC_USART_T * uart, uint32_t mascara);
+void Chip_UART_IntDisable(LPC_USART_T * uart, uint32_t mascara);
+uint32_t Chip_UART_GetIntsEnabled(LPC_USART_T * uart);
+uint32_t Chip_UART_ReadIntIDReg(LPC_USART_T * uart);
+uint32_t Chip_UART_ReadLineStatus(LPC_USART_T * uart);
+void Chip_UART_SetupFIFOS(LPC_USART_T * uart, uint32_t fcr);
+void Chip_UART_TXEnable(LPC_USART_T * uart);
+void Chip_UART_TXDisable(LPC_USART_T * uart);
+void Chip_UART_Init(LPC_USART_T * uart);
+uint32_t Chip_UART_SetBaud(LPC_USART_T * uart, uint32_t baudios);
+void Chip_UART_ConfigData(LPC_USART_T * uart, uint32_t configuracion);
+void Chip_UART_SetRS485Flags(LPC_USART_T * uart, uint32_t opciones);
+void Chip_UART_EnableDivisorAccess(LPC_USART_T * uart);
+void Chip_UART_DisableDivisorAccess(LPC_USART_T * uart);
+void Chip_UART_SetDivisorLatches(LPC_USART_T * uart, uint8_t dll, uint8_t dlm);
+
+uint32_t Chip_Clock_GetRate(CHIP_CCU_CLK_T reloj);
+
+void Chip_CRC_Init(void);
+void Chip_CRC_UseCCITT(void);
+uint32_t Chip_CRC_CRC8(const uint8_t * datos, uint32_t cantidad);
+uint32_t Chip_CRC_Sum(void);
+
+void Chip_SCU_PinMux(uint8_t puerto, uint8_t pin, uint16_t modo, uint8_t funcion);
+
+void Chip_SCU_GPIOIntPinSel(uint8_t canal, uint8_t puerto, uint8_t pin);
+void Chip_PININT_SetPinModeEdge(LPC_PIN_INT_T * pinint, uint32_t canales);
+void Chip_PININT_EnableIntLow(LPC_PIN_INT_T * pinint, uint32_t canales);
+void Chip_PININT_EnableIntHigh(LPC_PIN_INT_T * pinint, uint32_t canales);
+void Chip_PININT_ClearIntStatus(LPC_PIN_INT_T * pinint, uint32_t canales);
+
+void Chip_GPDMA_Init(LPC_GPDMA_T * dma);
+uint8_t Chip_GPDMA_GetFreeChannel(LPC_GPDMA_T * dma, uint32_t conexion);
+Status Chip_GPDMA_Transfer(LPC_GPDMA_T * dma, uint8_t canal, uint32_t origen,
+   uint32_t destino, GPDMA_FLOW_CONTROL_T tipo, uint32_t cantidad);
+Status Chip_GPDMA_Interrupt(LPC_GPDMA_T * dma, uint8_t canal);
+
+void NVIC_SetPendingIRQ(IRQn_Type interrupcion);
+void NVIC_EnableIRQ(IRQn_Type interrupcion);
+
+/* === Ciere de documentacion ============================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* CHIP_H */
@@ -0,0 +1,84 @@
+/* Copyright 2026, Gustavo Sosa - UTN FRT
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef LED_H    /*! @cond    */
+#define LED_H    /*! @endcond */
+
+/** @file led.h
+ **
+ ** @brief Sustituto del controlador de leds para el banco de pruebas
+ **
+ ** Los leds no tienen efecto en la simulación.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2026.10.14 | gsosa       | Version inicial del archivo             |
+ **
+ ** @addtogroup ejemplos
+ ** @{
+ */
+
+/* === Inclusiones de archivos externos ==================================== */
+#include <stdint.h>
+
+/* === Cabecera C++ ======================================================== */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros ================================================= */
+
+#define RGB_R_LED             0
+#define RGB_G_LED             1
+#define RGB_B_LED             2
+#define RED_LED               3
+#define YELLOW_LED            4
+#define GREEN_LED             5
+
+/* == Declaraciones de tipos de datos ====================================== */
+
+/* === Declaraciones de variables externas ================================= */
+
+/* === Declaraciones de funciones externas ================================= */
+
+void Init_Leds(void);
+void Led_On(uint8_t led);
+void Led_Off(uint8_t led);
+void Led_Toggle(uint8_t led);
+
+/* === Ciere de documentacion ============================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* LED_H */
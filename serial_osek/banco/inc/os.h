@@ -0,0 +1,137 @@
+/* Copyright 2026, Gustavo Sosa - UTN FRT
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef OS_H    /*! @cond    */
+#define OS_H    /*! @endcond */
+
+/** @file os.h
+ **
+ ** @brief Sustituto de FreeOSEK para el banco de pruebas
+ **
+ ** Declara los servicios del sistema operativo y los objetos de serial_osek.oil
+ ** con los mismos nombres que genera FreeOSEK. Las tareas no se planifican, el
+ ** programa del banco las ejecuta directamente y @ref WaitEvent avanza el tiempo
+ ** simulado hasta que llega el evento.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  2 | 2026.10.14 | gsosa       | Servicio Schedule                       |
+ ** |  1 | 2026.10.14 | gsosa       | Version inicial del archivo             |
+ **
+ ** @addtogroup ejemplos
+ ** @{
+ */
+
+/* === Inclusiones de archivos externos ==================================== */
+#include <stdint.h>
+
+/* === Cabecera C++ ======================================================== */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros ================================================= */
+
+#define E_OK                  0
+#define E_OS_STATE            7
+
+#define INVALID_TASK          ((TaskType) 0xFE)
+
+#define TASK(nombre)          void OSEK_TASK_##nombre(void)
+#define ISR(nombre)           void OSEK_ISR_##nombre(void)
+#define ALARMCALLBACK(nombre) void OSEK_CALLBACK_##nombre(void)
+
+//! Modos de aplicación
+#define Normal                0
+
+//! Eventos en el orden de serial_osek.oil
+#define Completo              ((EventMaskType) (1 << 0))
+#define Recibido              ((EventMaskType) (1 << 1))
+#define RecibidoRs485         ((EventMaskType) (1 << 2))
+#define RecibidoRs232         ((EventMaskType) (1 << 3))
+
+/* == Declaraciones de tipos de datos ====================================== */
+
+typedef uint8_t TaskType;
+typedef uint32_t EventMaskType;
+typedef uint8_t AlarmType;
+typedef uint8_t ResourceType;
+typedef uint32_t TickType;
+typedef uint8_t StatusType;
+typedef uint8_t AppModeType;
+
+//! Tareas en el orden de serial_osek.oil
+enum {
+   Configuracion, Enviar, Recepcion, Teclado, Ocioso, TASKS_COUNT,
+};
+
+//! Alarmas en el orden de serial_osek.oil
+enum {
+   RevisarTeclado, Antirrebote, IncrementarSegundo, Agrupar, PasoSegundo, ALARMS_COUNT,
+};
+
+//! Recursos en el orden de serial_osek.oil
+enum {
+   RecursoSerial, RESOURCES_COUNT,
+};
+
+/* === Declaraciones de variables externas ================================= */
+
+/* === Declaraciones de funciones externas ================================= */
+
+StatusType ActivateTask(TaskType tarea);
+StatusType ChainTask(TaskType tarea);
+StatusType TerminateTask(void);
+StatusType GetTaskID(TaskType * tarea);
+StatusType SetEvent(TaskType tarea, EventMaskType eventos);
+StatusType ClearEvent(EventMaskType eventos);
+StatusType WaitEvent(EventMaskType eventos);
+StatusType Schedule(void);
+StatusType GetResource(ResourceType recurso);
+StatusType ReleaseResource(ResourceType recurso);
+StatusType SetRelAlarm(AlarmType alarma, TickType desplazamiento, TickType ciclo);
+StatusType CancelAlarm(AlarmType alarma);
+StatusType GetAlarm(AlarmType alarma, TickType * restante);
+void StartOS(AppModeType modo);
+void ShutdownOS(StatusType error);
+void SuspendAllInterrupts(void);
+void ResumeAllInterrupts(void);
+void SuspendOSInterrupts(void);
+void ResumeOSInterrupts(void);
+
+/* === Ciere de documentacion ============================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* OS_H */
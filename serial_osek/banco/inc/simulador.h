@@ -0,0 +1,139 @@
+/* Copyright 2026, Gustavo Sosa - UTN FRT
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SIMULADOR_H    /*! @cond    */
+#define SIMULADOR_H    /*! @endcond */
+
+/** @file simulador.h
+ **
+ ** @brief Simulación de la uart, el DMA y el sistema operativo
+ **
+ ** Modelo en tiempo de ciclos de la uart de depuración con su FIFO de
+ ** transmisión de 16 bytes y su registro de desplazamiento, del canal de DMA y de
+ ** las interrupciones. El tiempo solo avanza cuando la tarea en ejecución espera un
+ ** evento o cuando el banco vacia la linea con @ref SimuladorVaciar. El
+ ** receptor puede pedir pausas periodicas con los caracteres XOFF y XON. De
+ ** las alarmas solo se simula Agrupar, con ticks de un milisegundo.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  3 | 2026.10.14 | gsosa       | Alarma de agrupamiento de mensajes      |
+ ** |  2 | 2026.10.14 | gsosa       | Pausas del receptor con XON y XOFF      |
+ ** |  1 | 2026.10.14 | gsosa       | Version inicial del archivo             |
+ **
+ ** @addtogroup ejemplos
+ ** @{
+ */
+
+/* === Inclusiones de archivos externos ==================================== */
+#include <stdint.h>
+#include <stdbool.h>
+#include "os.h"
+
+/* === Cabecera C++ ======================================================== */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros ================================================= */
+
+//! Cantidad de bytes de la FIFO de transmisión de la uart simulada
+#define SIMULADOR_FIFO        16
+
+//! Cantidad maxima de bytes transmitidos que se guardan para verificarlos
+#define SIMULADOR_CAPTURA     (1 << 20)
+
+//! Duración de cada pausa del receptor en tiempos de byte
+#define SIMULADOR_PAUSA       32
+
+//! Caracteres de control de flujo que envia el receptor
+#define SIMULADOR_XON         0x11
+#define SIMULADOR_XOFF        0x13
+
+/* == Declaraciones de tipos de datos ====================================== */
+
+//! Parametros de temporización de la simulación
+typedef struct {
+   uint32_t reloj;               /** < Frecuencia del procesador en Hz */
+   uint32_t baudios;             /** < Velocidad de la uart, 10 bits por byte */
+   uint32_t latencia;            /** < Ciclos entre el pedido y la atención */
+   uint32_t costo;               /** < Ciclos que dura cada atención */
+   uint32_t pausa;               /** < Bytes entre pausas del receptor, cero sin pausas */
+} simulador_config_t;
+
+//! Estado y contadores de la simulación
+typedef struct {
+   uint64_t ahora;               /** < Tiempo simulado en ciclos */
+   uint32_t interrupciones;      /** < Atenciones de rutinas de servicio */
+   uint32_t desbordes;           /** < Bytes escritos con la FIFO llena */
+   uint64_t nanosegundos;        /** < Tiempo real de las rutinas en la computadora */
+   uint32_t transmitidos;        /** < Bytes que salieron por la linea */
+   uint32_t maximo_en_pausa;     /** < Mayor cantidad de bytes durante una pausa */
+   uint8_t captura[SIMULADOR_CAPTURA]; /** < Bytes transmitidos */
+} simulador_t;
+
+/* === Declaraciones de variables externas ================================= */
+
+//! Estado de la simulación en curso
+extern simulador_t simulador;
+
+/* === Declaraciones de funciones externas ================================= */
+
+/** @brief Reinicia la simulación con una configuración de temporización
+ **
+ ** @param[in] config Parametros de la uart y de las interrupciones.
+ */
+void SimuladorIniciar(const simulador_config_t * config);
+
+/** @brief Cambia la tarea que el sistema operativo simulado tiene en ejecución
+ **
+ ** @param[in] tarea Tarea que llama a los servicios a partir de ahora.
+ */
+void SimuladorTarea(TaskType tarea);
+
+/** @brief Avanza el tiempo simulado hasta el siguiente evento
+ **
+ ** @return Indica si habia algun evento pendiente en la uart o en el DMA.
+ */
+bool SimuladorPaso(void);
+
+/** @brief Avanza el tiempo simulado hasta que se transmite el ultimo byte
+ */
+void SimuladorVaciar(void);
+
+/* === Ciere de documentacion ============================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* SIMULADOR_H */
@@ -0,0 +1,401 @@
+/* Copyright 2026, Gustavo Sosa - UTN FRT
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file banco.c
+ **
+ ** @brief Banco de pruebas de la transmisión serial en la computadora
+ **
+ ** Ejecuta el motor de transmisión de serial.c sobre la uart simulada con una
+ ** serie de mensajes de distintos tamaños e informa para cada tamaño la velocidad
+ ** efectiva en bytes por segundo, la cantidad de interrupciones por mensaje y la
+ ** peor demora entre que la tarea encola el mensaje y que recibe el evento
+ ** Completo. Cada mensaje se envia con @ref EnviarDatos y se espera con
+ ** @ref EsperarTransmision desde la tarea Enviar. Con la opción -p los mensajes
+ ** pares que entran en un bloque se entregan con @ref EntregarMensaje y con la
+ ** opción -a la tarea no espera el evento sino un aviso de @ref AvisarTransmision.
+ ** Con la opción -x el receptor pide una pausa con XOFF cada la cantidad de bytes
+ ** indicada, que solo se respeta si el proyecto se compila con SERIAL_XONXOFF.
+ ** Con la opción -g la tarea espera solo cada la cantidad de mensajes indicada y
+ ** la demora se mide desde el primer mensaje del grupo, lo que permite ver el
+ ** efecto de compilar con SERIAL_AGRUPAR_VENTANA. Antes de las mediciones se
+ ** verifica que una plantilla con un campo mas ancho y con mas decimales que
+ ** los limites de formato.h se transmite recortada a esos limites, y que dos
+ ** avisos urgentes encolados en medio de un mensaje normal salen juntos en el
+ ** siguiente limite, con la politica de lote.c que comparte el coprocesador.
+ **
+ **     banco [-b baudios] [-r reloj] [-l latencia] [-c costo] [-m mensajes] [-p] [-a]
+ **           [-x bytes] [-g mensajes] [tamaños...]
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  7 | 2026.10.14 | gsosa       | Lote de avisos urgentes en un limite    |
+ ** |  6 | 2026.10.14 | gsosa       | Plantilla fuera de los limites          |
+ ** |  5 | 2026.10.14 | gsosa       | Espera por grupos de mensajes           |
+ ** |  4 | 2026.10.14 | gsosa       | Pausas del receptor con XON y XOFF      |
+ ** |  3 | 2026.10.14 | gsosa       | Avisos de transmisión completa          |
+ ** |  2 | 2026.10.14 | gsosa       | Mensajes en bloques de memoria propios  |
+ ** |  1 | 2026.10.14 | gsosa       | Version inicial del archivo             |
+ **
+ ** @addtogroup ejemplos
+ ** @{
+ */
+
+/* === Inclusiones de cabeceras ============================================ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "simulador.h"
+#include "serial.h"
+#include "bloques.h"
+#include "formato.h"
+#include "chip.h"
+#include "os.h"
+
+/* === Definicion y Macros ================================================= */
+
+//! Cantidad maxima de tamaños de mensaje que se pueden medir
+#define TAMANIOS_MAXIMOS      32
+
+//! Longitud maxima de un mensaje
+#define MENSAJE_MAXIMO        8192
+
+/** @brief Bytes que pueden terminar de salir despues de recibir XOFF
+ **
+ ** El byte que esta en la linea y el que empieza antes de que la rutina de
+ ** servicio atienda la recepción.
+ */
+#define PAUSA_TOLERANCIA      2
+
+//! Cantidad de mensajes normales de la prueba de avisos urgentes
+#define URGENTES_MENSAJES     3
+
+//! Longitud de cada mensaje normal de la prueba de avisos urgentes
+#define URGENTES_LONGITUD     40
+
+/* Sin limites entre mensajes los avisos urgentes pueden partir un mensaje */
+#if !defined(SERIAL_URGENTE_LIMITES) || SERIAL_URGENTE_LIMITES
+   #define URGENTES_EN_LIMITES   TRUE
+#else
+   #define URGENTES_EN_LIMITES   FALSE
+#endif
+
+/* === Declaraciones de tipos de datos internos ============================ */
+
+//! Resultados de la medición de un tamaño de mensaje
+typedef struct {
+   uint64_t duracion;            /** < Ciclos hasta que sale el ultimo byte */
+   uint64_t latencia_maxima;     /** < Peor demora hasta el evento Completo */
+   uint64_t latencia_total;      /** < Suma de las demoras hasta Completo */
+   uint32_t interrupciones;      /** < Atenciones de las rutinas de servicio */
+   uint64_t nanosegundos;        /** < Tiempo real de las rutinas de servicio */
+   bool correcto;                /** < Los bytes transmitidos son los esperados */
+} resultado_t;
+
+/* === Declaraciones de funciones internas ================================= */
+
+//! Tarea de configuración definida en serial.c
+void OSEK_TASK_Configuracion(void);
+
+/** @brief Mide la transmisión de una serie de mensajes de un tamaño
+ **
+ ** @param[in] config Temporización de la simulación.
+ ** @param[in] tamanio Cantidad de bytes de cada mensaje.
+ ** @param[in] mensajes Cantidad de mensajes.
+ ** @param[in] bloques Entrega los mensajes pares en bloques de memoria.
+ ** @param[in] avisos Espera cada mensaje con un aviso en lugar del evento.
+ ** @param[in] grupo Cantidad de mensajes que se envian antes de cada espera.
+ ** @param[out] resultado Resultados de la medición.
+ */
+void Medir(const simulador_config_t * config, uint32_t tamanio, uint32_t mensajes,
+   bool bloques, bool avisos, uint32_t grupo, resultado_t * resultado);
+
+/** @brief Verifica el recorte de un campo de plantilla fuera de los limites
+ **
+ ** @param[in] config Temporización de la simulación.
+ ** @return Indica si el texto transmitido es el esperado.
+ */
+bool ProbarPlantilla(const simulador_config_t * config);
+
+/** @brief Verifica el intercalado de un lote de avisos urgentes
+ **
+ ** @param[in] config Temporización de la simulación.
+ ** @return Indica si los avisos salieron juntos y, con limites entre
+ **         mensajes, al terminar el primer mensaje normal.
+ */
+bool ProbarUrgentes(const simulador_config_t * config);
+
+/** @brief Registra el momento del aviso de transmisión completa
+ **
+ ** @param[out] parametro Puntero a la variable donde se guarda el momento.
+ */
+void Anotar(void * parametro);
+
+/* === Definiciones de variables internas ================================== */
+
+//! Contenido de los mensajes, cada uno empieza en un desplazamiento distinto
+uint8_t patron[MENSAJE_MAXIMO + 256];
+
+/* === Definiciones de variables externas ================================== */
+
+/* === Definiciones de funciones internas ================================== */
+
+void Anotar(void * parametro) {
+   *(uint64_t *) parametro = simulador.ahora;
+}
+
+bool ProbarPlantilla(const simulador_config_t * config) {
+   static const campo_t campos[] = {
+      { LITERAL("Valor "), FORMATO_FIJO, 40, 12, ' ' },
+   };
+   static const int32_t valores[] = { -1234567 };
+   static const char esperado[] = "Valor     -0.001234567";
+   bool correcto;
+
+   SimuladorIniciar(config);
+   SimuladorTarea(Configuracion);
+   OSEK_TASK_Configuracion();
+
+   SimuladorTarea(Enviar);
+   correcto = EnviarPlantilla(campos, 1, valores);
+   SimuladorVaciar();
+
+   return (correcto && (simulador.desbordes == 0)
+      && (simulador.transmitidos == sizeof(esperado) - 1)
+      && (memcmp(simulador.captura, esperado, sizeof(esperado) - 1) == 0));
+}
+
+bool ProbarUrgentes(const simulador_config_t * config) {
+   static const char avisos[] = "<1><2>";
+   uint8_t mensaje[URGENTES_LONGITUD];
+   uint32_t normales = 0;
+   uint32_t posicion = 0;
+   uint32_t indice;
+   bool correcto = TRUE;
+
+   SimuladorIniciar(config);
+   SimuladorTarea(Configuracion);
+   OSEK_TASK_Configuracion();
+
+   SimuladorTarea(Enviar);
+   for (indice = 0; indice < URGENTES_MENSAJES; indice++) {
+      memset(mensaje, 'a' + indice, sizeof(mensaje));
+      correcto = correcto && EnviarBloque(mensaje, sizeof(mensaje));
+   }
+   /* Los avisos llegan cuando el primer mensaje ya empezó a salir */
+   while ((simulador.transmitidos == 0) && SimuladorPaso()) {
+   }
+   correcto = correcto && EnviarUrgente(LITERAL("<1>")) && EnviarUrgente(LITERAL("<2>"));
+   SimuladorVaciar();
+
+   correcto = correcto && (simulador.desbordes == 0)
+      && (simulador.transmitidos == URGENTES_MENSAJES * URGENTES_LONGITUD + sizeof(avisos) - 1);
+   /* Sin los avisos quedan los mensajes normales completos y en orden */
+   for (indice = 0; correcto && (indice < simulador.transmitidos); indice++) {
+      if (simulador.captura[indice] == avisos[0]) {
+         posicion = indice;
+         correcto = (memcmp(&simulador.captura[indice], avisos, sizeof(avisos) - 1) == 0);
+         indice += sizeof(avisos) - 2;
+      } else {
+         correcto = (simulador.captura[indice] == 'a' + normales / URGENTES_LONGITUD);
+         normales++;
+      }
+   }
+   return (correcto && (!URGENTES_EN_LIMITES || (posicion == URGENTES_LONGITUD)));
+}
+
+void Medir(const simulador_config_t * config, uint32_t tamanio, uint32_t mensajes,
+   bool bloques, bool avisos, uint32_t grupo, resultado_t * resultado) {
+   uint64_t inicio = 0, latencia, aviso = 1;
+   uint32_t mensaje, indice;
+   void * bloque;
+
+   memset(resultado, 0, sizeof(*resultado));
+   SimuladorIniciar(config);
+   SimuladorTarea(Configuracion);
+   OSEK_TASK_Configuracion();
+
+   SimuladorTarea(Enviar);
+   for (mensaje = 0; mensaje < mensajes; mensaje++) {
+      if (mensaje % grupo == 0) {
+         inicio = simulador.ahora;
+      }
+      bloque = NULL;
+      if (bloques && (mensaje % 2 == 0) && (tamanio <= BLOQUES_TAMANIO)) {
+         bloque = PedirMensaje();
+      }
+      if (bloque != NULL) {
+         memcpy(bloque, &patron[mensaje % 256], tamanio);
+         EntregarMensaje(bloque, tamanio);
+      } else {
+         EnviarDatos(&patron[mensaje % 256], tamanio);
+      }
+      if (((mensaje + 1) % grupo == 0) || (mensaje + 1 == mensajes)) {
+         if (avisos) {
+            aviso = 0;
+            AvisarTransmision(INVALID_TASK, Anotar, &aviso);
+            while ((aviso == 0) && SimuladorPaso()) {
+            }
+         } else {
+            EsperarTransmision();
+         }
+         latencia = simulador.ahora - inicio;
+
+         resultado->latencia_total += latencia;
+         if (latencia > resultado->latencia_maxima) {
+            resultado->latencia_maxima = latencia;
+         }
+      }
+   }
+   SimuladorVaciar();
+
+   resultado->duracion = simulador.ahora;
+   resultado->interrupciones = simulador.interrupciones;
+   resultado->nanosegundos = simulador.nanosegundos;
+   resultado->correcto = (simulador.desbordes == 0)
+      && (simulador.transmitidos == tamanio * mensajes)
+      && (BloquesLibres() == BLOQUES_CANTIDAD)
+      && (simulador.maximo_en_pausa <= PAUSA_TOLERANCIA)
+      && (!avisos || (aviso != 0));
+   for (indice = 0; resultado->correcto && (indice < simulador.transmitidos)
+      && (indice < SIMULADOR_CAPTURA); indice++) {
+      resultado->correcto = (simulador.captura[indice]
+         == patron[(indice / tamanio) % 256 + indice % tamanio]);
+   }
+}
+
+/* === Definiciones de funciones externas ================================== */
+
+int main(int argc, char * argv[]) {
+   simulador_config_t config = {
+      .reloj = 204000000,
+      .baudios = 115200,
+      .latencia = 12,
+      .costo = 200,
+      .pausa = 0,
+   };
+   static const uint32_t predeterminados[] = { 1, 8, 16, 17, 64, 256, 1024, 4096 };
+   uint32_t tamanios[TAMANIOS_MAXIMOS];
+   uint32_t cantidad = 0;
+   uint32_t mensajes = 16;
+   uint32_t indice;
+   resultado_t resultado;
+   double maximo, velocidad;
+   bool correcto = TRUE;
+   bool prueba;
+   bool bloques = FALSE;
+   bool avisos = FALSE;
+   uint32_t grupo = 1;
+   int opcion;
+
+   while ((opcion = getopt(argc, argv, "b:r:l:c:m:pax:g:")) != -1) {
+      switch (opcion) {
+      case 'b':
+         config.baudios = strtoul(optarg, NULL, 0);
+         break;
+      case 'r':
+         config.reloj = strtoul(optarg, NULL, 0);
+         break;
+      case 'l':
+         config.latencia = strtoul(optarg, NULL, 0);
+         break;
+      case 'c':
+         config.costo = strtoul(optarg, NULL, 0);
+         break;
+      case 'm':
+         mensajes = strtoul(optarg, NULL, 0);
+         break;
+      case 'p':
+         bloques = TRUE;
+         break;
+      case 'a':
+         avisos = TRUE;
+         break;
+      case 'x':
+         config.pausa = strtoul(optarg, NULL, 0);
+         break;
+      case 'g':
+         grupo = strtoul(optarg, NULL, 0);
+         if (grupo == 0) {
+            grupo = 1;
+         }
+         break;
+      default:
+         fprintf(stderr, "Uso: %s [-b baudios] [-r reloj] [-l latencia] [-c costo]"
+            " [-m mensajes] [-p] [-a] [-x bytes] [-g mensajes] [tamaños...]\n", argv[0]);
+         return (2);
+      }
+   }
+   for (; (optind < argc) && (cantidad < TAMANIOS_MAXIMOS); optind++) {
+      tamanios[cantidad] = strtoul(argv[optind], NULL, 0);
+      if ((tamanios[cantidad] > 0) && (tamanios[cantidad] <= MENSAJE_MAXIMO)) {
+         cantidad++;
+      }
+   }
+   if (cantidad == 0) {
+      cantidad = sizeof(predeterminados) / sizeof(predeterminados[0]);
+      memcpy(tamanios, predeterminados, sizeof(predeterminados));
+   }
+   for (indice = 0; indice < sizeof(patron); indice++) {
+      patron[indice] = (uint8_t) (indice * 7 + 1);
+   }
+
+   correcto = ProbarPlantilla(&config);
+   printf("Plantilla con ancho 40 y 12 decimales%s\n", correcto ? "" : "  ERROR");
+   prueba = ProbarUrgentes(&config);
+   printf("Avisos urgentes en medio de un mensaje%s\n", prueba ? "" : "  ERROR");
+   correcto = correcto && prueba;
+
+   maximo = (double) config.baudios / 10;
+   printf("Uart a %u baudios, reloj de %u Hz, latencia de %u ciclos y %u ciclos"
+      " por interrupción, %u mensajes\n", config.baudios, config.reloj,
+      config.latencia, config.costo, mensajes);
+   printf("%8s %12s %8s %12s %14s %14s %10s\n", "Tamaño", "Bytes/s", "Uso",
+      "Int/mensaje", "Completo (us)", "Maximo (us)", "ns/int");
+
+   for (indice = 0; indice < cantidad; indice++) {
+      Medir(&config, tamanios[indice], mensajes, bloques, avisos, grupo, &resultado);
+      velocidad = (double) tamanios[indice] * mensajes * config.reloj / resultado.duracion;
+      printf("%8u %12.0f %7.1f%% %12.2f %14.1f %14.1f %10.0f%s\n", tamanios[indice],
+         velocidad, 100.0 * velocidad / maximo,
+         (double) resultado.interrupciones / mensajes,
+         1e6 * resultado.latencia_total / mensajes / config.reloj,
+         1e6 * resultado.latencia_maxima / config.reloj,
+         (double) resultado.nanosegundos / resultado.interrupciones,
+         resultado.correcto ? "" : "  ERROR");
+      correcto = correcto && resultado.correcto;
+   }
+   return (correcto ? 0 : 1);
+}
+
+/* === Ciere de documentacion ============================================== */
+
+/** @} Final de la definición del modulo para doxygen */
@@ -0,0 +1,770 @@
+/* Copyright 2026, Gustavo Sosa - UTN FRT
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file simulador.c
+ **
+ ** @brief Simulación de la uart, el DMA y el sistema operativo
+ **
+ ** Implementación de los periféricos de LPCOpen, de los controladores de la
+ ** EDU-CIAA y de los servicios de FreeOSEK que usan los fuentes del proyecto.
+ ** Cada rutina de servicio se ejecuta @ref simulador_config_t::latencia ciclos
+ ** despues de su pedido y consume @ref simulador_config_t::costo ciclos, durante
+ ** los cuales la uart sigue transmitiendo.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  5 | 2026.10.14 | gsosa       | Servicio Schedule                       |
+ ** |  4 | 2026.10.14 | gsosa       | Causa de las interrupciones de recepción|
+ ** |  3 | 2026.10.14 | gsosa       | Alarma de agrupamiento de mensajes      |
+ ** |  2 | 2026.10.14 | gsosa       | Pausas del receptor con XON y XOFF      |
+ ** |  1 | 2026.10.14 | gsosa       | Version inicial del archivo             |
+ **
+ ** @addtogroup ejemplos
+ ** @{
+ */
+
+/* === Inclusiones de cabeceras ============================================ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "simulador.h"
+#include "chip.h"
+#include "uart.h"
+#include "led.h"
+#include "switch.h"
+#include "os.h"
+#include "Os_Internal.h"
+
+/* === Definicion y Macros ================================================= */
+
+//! Cantidad maxima de atenciones seguidas sin transmitir ningun byte
+#define ATENCIONES_MAXIMAS    1000
+
+/* === Declaraciones de tipos de datos internos ============================ */
+
+/* === Declaraciones de funciones internas ================================= */
+
+//! Rutina de servicio de la uart definida en serial.c
+void OSEK_ISR_EventoSerial(void);
+
+//! Rutina de servicio del DMA definida en serial.c
+void OSEK_ISR_EventoDma(void);
+
+//! Rutina de la alarma Agrupar de serial.c
+void OSEK_CALLBACK_Agrupar(void);
+
+/** @brief Termina el programa informando un error de la simulación
+ **
+ ** @param[in] mensaje Descripción del error.
+ */
+void Fallar(const char * mensaje);
+
+/** @brief Escribe un byte en la FIFO de transmisión de la uart
+ **
+ ** Si el registro de desplazamiento esta libre el byte pasa directamente al
+ ** mismo y la FIFO sigue vacia, como en la uart real.
+ **
+ ** @param[in] dato Byte a transmitir.
+ */
+void Transmitir(uint8_t dato);
+
+/** @brief Entrega a la uart los bytes de la transferencia de DMA en curso
+ */
+void AlimentarDma(void);
+
+/** @brief Entrega a la uart un byte enviado por el receptor
+ **
+ ** @param[in] dato Byte recibido.
+ */
+void Recibir(uint8_t dato);
+
+/** @brief Avanza el tiempo simulado transmitiendo los bytes de la FIFO
+ **
+ ** @param[in] tiempo Tiempo simulado final en ciclos.
+ */
+void AvanzarHasta(uint64_t tiempo);
+
+/** @brief Indica si la uart tiene una interrupción pendiente
+ */
+bool PendienteUart(void);
+
+/** @brief Ejecuta las rutinas de servicio con interrupciones pendientes
+ **
+ ** No hace nada si se llama desde una rutina de servicio o con las
+ ** interrupciones suspendidas, en ese caso el pedido se atiende despues.
+ */
+void Atender(void);
+
+/* === Definiciones de variables internas ================================== */
+
+//! Parametros de temporización de la simulación en curso
+simulador_config_t config;
+
+//! Ciclos que tarda la uart en transmitir un byte
+uint64_t tiempo_byte;
+
+//! Cantidad de bytes en la FIFO de transmisión
+uint32_t fifo;
+
+//! Indica que el registro de desplazamiento esta transmitiendo un byte
+bool en_linea;
+
+//! Momento en que termina de salir el byte del registro de desplazamiento
+uint64_t fin_byte;
+
+//! Indica que la transmisión esta deshabilitada por el registro TER
+bool detenida;
+
+//! Indica que el receptor pidió una pausa con XOFF
+bool en_pausa;
+
+//! Momento en que el receptor termina la pausa con XON
+uint64_t fin_pausa;
+
+//! Bytes que terminaron de salir durante la pausa en curso
+uint32_t en_pausa_transmitidos;
+
+//! Byte que envió el receptor
+uint8_t dato_recibido;
+
+//! Indica que la uart tiene un byte recibido sin leer
+bool recibido_pendiente;
+
+//! Indica que se vació la FIFO desde la ultima escritura de la uart
+bool thre_pendiente;
+
+//! Pedido de interrupción de la uart por software
+bool pendiente_uart;
+
+//! Indica que hay una transferencia de DMA en curso
+bool dma_activo;
+
+//! Siguiente byte de la transferencia de DMA en curso
+const uint8_t * dma_origen;
+
+//! Bytes que faltan entregar de la transferencia de DMA en curso
+uint32_t dma_restante;
+
+//! Pedido de interrupción de fin de transferencia del DMA
+bool dma_fin;
+
+//! Indica que se esta ejecutando una rutina de servicio
+bool en_interrupcion;
+
+//! Cantidad de llamadas anidadas para suspender las interrupciones
+uint32_t suspendidas;
+
+//! Cantidad de bytes cargados en la uart
+uint32_t cargados;
+
+//! Memoria para las pilas de las tareas
+uint8_t pilas[TASKS_COUNT][512];
+
+//! Tarea en ejecución
+TaskType actual;
+
+//! Eventos pendientes de cada tarea
+EventMaskType eventos[TASKS_COUNT];
+
+//! Indica que la alarma Agrupar esta corriendo
+bool agrupar_activa;
+
+//! Momento en que vence la alarma Agrupar
+uint64_t fin_agrupar;
+
+//! Suma del motor de CRC
+uint16_t suma_crc;
+
+/* === Definiciones de variables externas ================================== */
+
+simulador_t simulador;
+
+const TaskConstType TasksConst[TASKS_COUNT] = {
+   [Configuracion] = { pilas[Configuracion], sizeof(pilas[0]) },
+   [Enviar] = { pilas[Enviar], sizeof(pilas[0]) },
+   [Recepcion] = { pilas[Recepcion], sizeof(pilas[0]) },
+   [Teclado] = { pilas[Teclado], sizeof(pilas[0]) },
+   [Ocioso] = { pilas[Ocioso], sizeof(pilas[0]) },
+};
+
+uint32_t SystemCoreClock;
+
+LPC_USART_T uart_simulada[4];
+
+LPC_PIN_INT_T pinint_simulado;
+
+LPC_GPDMA_T gpdma_simulado;
+
+DWT_Type dwt_simulado;
+
+CoreDebug_Type coredebug_simulado;
+
+/* === Definiciones de funciones internas ================================== */
+
+void Fallar(const char * mensaje) {
+   fprintf(stderr, "Error en la simulación a los %llu ciclos: %s\n",
+      (unsigned long long) simulador.ahora, mensaje);
+   exit(1);
+}
+
+void Transmitir(uint8_t dato) {
+   if ((en_linea || detenida) && (fifo == SIMULADOR_FIFO)) {
+      simulador.desbordes++;
+   } else {
+      if (cargados < SIMULADOR_CAPTURA) {
+         simulador.captura[cargados] = dato;
+      }
+      cargados++;
+
+      if (en_linea || detenida) {
+         fifo++;
+      } else {
+         en_linea = TRUE;
+         fin_byte = simulador.ahora + tiempo_byte;
+      }
+   }
+   thre_pendiente = (fifo == 0);
+}
+
+void AlimentarDma(void) {
+   while (dma_activo && (dma_restante > 0)
+      && ((!en_linea && !detenida) || (fifo < SIMULADOR_FIFO))) {
+      Transmitir(*dma_origen);
+      dma_origen++;
+      dma_restante--;
+   }
+   if (dma_activo && (dma_restante == 0)) {
+      dma_activo = FALSE;
+      dma_fin = TRUE;
+   }
+}
+
+void Recibir(uint8_t dato) {
+   dato_recibido = dato;
+   recibido_pendiente = TRUE;
+}
+
+void AvanzarHasta(uint64_t tiempo) {
+   while ((en_linea && (fin_byte <= tiempo)) || (en_pausa && (fin_pausa <= tiempo))) {
+      if (en_pausa && (!en_linea || (fin_pausa < fin_byte))) {
+         simulador.ahora = fin_pausa;
+         en_pausa = FALSE;
+         Recibir(SIMULADOR_XON);
+      } else {
+         simulador.ahora = fin_byte;
+         simulador.transmitidos++;
+         if (en_pausa) {
+            en_pausa_transmitidos++;
+            if (en_pausa_transmitidos > simulador.maximo_en_pausa) {
+               simulador.maximo_en_pausa = en_pausa_transmitidos;
+            }
+         } else if ((config.pausa > 0) && (simulador.transmitidos % config.pausa == 0)) {
+            en_pausa = TRUE;
+            fin_pausa = simulador.ahora + SIMULADOR_PAUSA * tiempo_byte;
+            en_pausa_transmitidos = 0;
+            Recibir(SIMULADOR_XOFF);
+         }
+
+         /* Con la transmisión deshabilitada la FIFO no pasa bytes a la linea */
+         if ((fifo > 0) && !detenida) {
+            fifo--;
+            fin_byte += tiempo_byte;
+            if (fifo == 0) {
+               thre_pendiente = TRUE;
+            }
+         } else {
+            en_linea = FALSE;
+         }
+         AlimentarDma();
+      }
+   }
+   if (tiempo > simulador.ahora) {
+      simulador.ahora = tiempo;
+   }
+   dwt_simulado.CYCCNT = (uint32_t) simulador.ahora;
+}
+
+bool PendienteUart(void) {
+   return (pendiente_uart || ((USB_UART->IER & UART_IER_THREINT) && thre_pendiente)
+      || ((USB_UART->IER & UART_IER_RBRINT) && recibido_pendiente));
+}
+
+void Atender(void) {
+   struct timespec inicio, fin;
+   uint32_t sin_progreso = 0;
+   uint32_t anterior;
+
+   if (en_interrupcion || (suspendidas > 0)) {
+      return;
+   }
+
+   while (dma_fin || PendienteUart()) {
+      AvanzarHasta(simulador.ahora + config.latencia);
+      anterior = cargados + simulador.transmitidos;
+
+      en_interrupcion = TRUE;
+      clock_gettime(CLOCK_MONOTONIC, &inicio);
+      if (dma_fin) {
+         OSEK_ISR_EventoDma();
+      } else {
+         pendiente_uart = FALSE;
+         OSEK_ISR_EventoSerial();
+      }
+      clock_gettime(CLOCK_MONOTONIC, &fin);
+      en_interrupcion = FALSE;
+
+      simulador.interrupciones++;
+      simulador.nanosegundos += (uint64_t) (fin.tv_sec - inicio.tv_sec) * 1000000000
+         + fin.tv_nsec - inicio.tv_nsec;
+      AvanzarHasta(simulador.ahora + config.costo);
+
+      if (cargados + simulador.transmitidos == anterior) {
+         if (++sin_progreso > ATENCIONES_MAXIMAS) {
+            Fallar("la rutina de servicio no atiende el pedido de interrupción");
+         }
+      } else {
+         sin_progreso = 0;
+      }
+   }
+}
+
+/* === Definiciones de funciones externas ================================== */
+
+void SimuladorIniciar(const simulador_config_t * nueva) {
+   config = *nueva;
+   tiempo_byte = (uint64_t) config.reloj * 10 / config.baudios;
+   SystemCoreClock = config.reloj;
+
+   memset(&simulador, 0, sizeof(simulador));
+   memset(uart_simulada, 0, sizeof(uart_simulada));
+   memset(eventos, 0, sizeof(eventos));
+   fifo = 0;
+   en_linea = FALSE;
+   detenida = FALSE;
+   en_pausa = FALSE;
+   agrupar_activa = FALSE;
+   recibido_pendiente = FALSE;
+   thre_pendiente = TRUE;
+   pendiente_uart = FALSE;
+   dma_activo = FALSE;
+   dma_fin = FALSE;
+   en_interrupcion = FALSE;
+   suspendidas = 0;
+   cargados = 0;
+   actual = INVALID_TASK;
+   dwt_simulado.CYCCNT = 0;
+}
+
+void SimuladorTarea(TaskType tarea) {
+   actual = tarea;
+}
+
+bool SimuladorPaso(void) {
+   uint64_t proximo;
+   bool evento = FALSE;
+
+   Atender();
+   if (en_linea || en_pausa || agrupar_activa) {
+      proximo = UINT64_MAX;
+      if (en_linea) {
+         proximo = fin_byte;
+      }
+      if (en_pausa && (fin_pausa < proximo)) {
+         proximo = fin_pausa;
+      }
+      if (agrupar_activa && (fin_agrupar < proximo)) {
+         proximo = fin_agrupar;
+      }
+      AvanzarHasta(proximo);
+
+      if (agrupar_activa && (fin_agrupar <= simulador.ahora)) {
+         /* La rutina de la alarma se ejecuta como una rutina de servicio */
+         agrupar_activa = FALSE;
+         en_interrupcion = TRUE;
+         OSEK_CALLBACK_Agrupar();
+         en_interrupcion = FALSE;
+      }
+      Atender();
+      evento = TRUE;
+   }
+   return (evento);
+}
+
+void SimuladorVaciar(void) {
+   while (SimuladorPaso()) {
+   }
+}
+
+/* --- LPCOpen ------------------------------------------------------------- */
+
+void Chip_UART_SendByte(LPC_USART_T * uart, uint8_t dato) {
+   if (uart == USB_UART) {
+      Transmitir(dato);
+   }
+}
+
+uint8_t Chip_UART_ReadByte(LPC_USART_T * uart) {
+   uint8_t dato = 0;
+
+   if (uart == USB_UART) {
+      dato = dato_recibido;
+      recibido_pendiente = FALSE;
+   }
+   return (dato);
+}
+
+void Chip_UART_IntEnable(LPC_USART_T * uart, uint32_t mascara) {
+   uart->IER |= mascara;
+   if (uart == USB_UART) {
+      Atender();
+   }
+}
+
+void Chip_UART_IntDisable(LPC_USART_T * uart, uint32_t mascara) {
+   uart->IER &= ~mascara;
+}
+
+uint32_t Chip_UART_GetIntsEnabled(LPC_USART_T * uart) {
+   return (uart->IER);
+}
+
+uint32_t Chip_UART_ReadIntIDReg(LPC_USART_T * uart) {
+   uint32_t identificacion = UART_IIR_INTSTAT_PEND;
+
+   /* Los bytes llegan de a uno, por lo que solo alcanzan el nivel de disparo
+      minimo y con los demas se informa el tiempo de espera entre caracteres */
+   if ((uart == USB_UART) && (uart->IER & UART_IER_RBRINT) && recibido_pendiente) {
+      if ((uart->FCR & UART_FCR_TRG_LEV3) == UART_FCR_TRG_LEV0) {
+         identificacion = UART_IIR_INTID_RDA;
+      } else {
+         identificacion = UART_IIR_INTID_CTI;
+      }
+   } else if ((uart == USB_UART) && (uart->IER & UART_IER_THREINT) && thre_pendiente) {
+      identificacion = UART_IIR_INTID_THRE;
+      thre_pendiente = FALSE;
+   }
+   return (identificacion);
+}
+
+uint32_t Chip_UART_ReadLineStatus(LPC_USART_T * uart) {
+   uint32_t estado = UART_LSR_THRE | UART_LSR_TEMT;
+
+   if (uart == USB_UART) {
+      estado = 0;
+      if (fifo == 0) {
+         estado |= UART_LSR_THRE;
+         if (!en_linea) {
+            estado |= UART_LSR_TEMT;
+         }
+      }
+      if (recibido_pendiente) {
+         estado |= UART_LSR_RDR;
+      }
+   }
+   return (estado);
+}
+
+void Chip_UART_SetupFIFOS(LPC_USART_T * uart, uint32_t fcr) {
+   uart->FCR = fcr;
+}
+
+void Chip_UART_TXEnable(LPC_USART_T * uart) {
+   uart->TER = 1;
+   if ((uart == USB_UART) && detenida) {
+      /* Los bytes que quedaron en la FIFO salen al habilitar la transmisión */
+      detenida = FALSE;
+      if (!en_linea && (fifo > 0)) {
+         fifo--;
+         en_linea = TRUE;
+         fin_byte = simulador.ahora + tiempo_byte;
+         thre_pendiente = (fifo == 0);
+      }
+      AlimentarDma();
+   }
+}
+
+void Chip_UART_TXDisable(LPC_USART_T * uart) {
+   uart->TER = 0;
+   if (uart == USB_UART) {
+      detenida = TRUE;
+   }
+}
+
+void Chip_UART_Init(LPC_USART_T * uart) {
+}
+
+uint32_t Chip_UART_SetBaud(LPC_USART_T * uart, uint32_t baudios) {
+   return (baudios);
+}
+
+void Chip_UART_ConfigData(LPC_USART_T * uart, uint32_t configuracion) {
+   uart->LCR = configuracion;
+}
+
+void Chip_UART_SetRS485Flags(LPC_USART_T * uart, uint32_t opciones) {
+}
+
+void Chip_UART_EnableDivisorAccess(LPC_USART_T * uart) {
+   uart->LCR |= UART_LCR_DLAB_EN;
+}
+
+void Chip_UART_DisableDivisorAccess(LPC_USART_T * uart) {
+   uart->LCR &= ~UART_LCR_DLAB_EN;
+}
+
+/* El divisor se guarda pero el banco transmite a la velocidad de la opción -b */
+void Chip_UART_SetDivisorLatches(LPC_USART_T * uart, uint8_t dll, uint8_t dlm) {
+   uart->DLL = dll;
+   uart->DLM = dlm;
+}
+
+uint32_t Chip_Clock_GetRate(CHIP_CCU_CLK_T reloj) {
+   return (SystemCoreClock);
+}
+
+/* El motor de CRC se reemplaza por el calculo bit a bit del CRC-CCITT */
+void Chip_CRC_Init(void) {
+}
+
+void Chip_CRC_UseCCITT(void) {
+   suma_crc = 0xFFFF;
+}
+
+uint32_t Chip_CRC_CRC8(const uint8_t * datos, uint32_t cantidad) {
+   uint8_t bit;
+
+   for (; cantidad > 0; cantidad--, datos++) {
+      suma_crc ^= (uint16_t) *datos << 8;
+      for (bit = 0; bit < 8; bit++) {
+         suma_crc = (suma_crc & 0x8000) ? (suma_crc << 1) ^ 0x1021 : (suma_crc << 1);
+      }
+   }
+   return (suma_crc);
+}
+
+uint32_t Chip_CRC_Sum(void) {
+   return (suma_crc);
+}
+
+void Chip_SCU_PinMux(uint8_t puerto, uint8_t pin, uint16_t modo, uint8_t funcion) {
+}
+
+void Chip_SCU_GPIOIntPinSel(uint8_t canal, uint8_t puerto, uint8_t pin) {
+}
+
+void Chip_PININT_SetPinModeEdge(LPC_PIN_INT_T * pinint, uint32_t canales) {
+   pinint->ISEL &= ~canales;
+}
+
+void Chip_PININT_EnableIntLow(LPC_PIN_INT_T * pinint, uint32_t canales) {
+   pinint->IENF |= canales;
+}
+
+void Chip_PININT_EnableIntHigh(LPC_PIN_INT_T * pinint, uint32_t canales) {
+   pinint->IENR |= canales;
+}
+
+void Chip_PININT_ClearIntStatus(LPC_PIN_INT_T * pinint, uint32_t canales) {
+   pinint->IST &= ~canales;
+}
+
+void Chip_GPDMA_Init(LPC_GPDMA_T * dma) {
+}
+
+uint8_t Chip_GPDMA_GetFreeChannel(LPC_GPDMA_T * dma, uint32_t conexion) {
+   return (0);
+}
+
+Status Chip_GPDMA_Transfer(LPC_GPDMA_T * dma, uint8_t canal, uint32_t origen,
+   uint32_t destino, GPDMA_FLOW_CONTROL_T tipo, uint32_t cantidad) {
+
+   if (dma_activo) {
+      Fallar("se inició una transferencia de DMA con otra en curso");
+   }
+   /* El banco se enlaza sin PIE para que las direcciones entren en 32 bits */
+   dma_origen = (const uint8_t *) (uintptr_t) origen;
+   dma_restante = cantidad;
+   dma_activo = TRUE;
+   AlimentarDma();
+   return (SUCCESS);
+}
+
+Status Chip_GPDMA_Interrupt(LPC_GPDMA_T * dma, uint8_t canal) {
+   Status resultado = ERROR;
+
+   if (dma_fin) {
+      dma_fin = FALSE;
+      resultado = SUCCESS;
+   }
+   return (resultado);
+}
+
+void NVIC_SetPendingIRQ(IRQn_Type interrupcion) {
+   if (interrupcion == USART2_IRQn) {
+      pendiente_uart = TRUE;
+   }
+   Atender();
+}
+
+void NVIC_EnableIRQ(IRQn_Type interrupcion) {
+}
+
+/* --- Controladores de la EDU-CIAA ---------------------------------------- */
+
+void Init_Uart_Ftdi(void) {
+}
+
+void Init_Leds(void) {
+}
+
+void Led_On(uint8_t led) {
+}
+
+void Led_Off(uint8_t led) {
+}
+
+void Led_Toggle(uint8_t led) {
+}
+
+void Init_Switches(void) {
+}
+
+uint8_t Read_Switches(void) {
+   return (0);
+}
+
+/* --- FreeOSEK ------------------------------------------------------------ */
+
+StatusType ActivateTask(TaskType tarea) {
+   return (E_OK);
+}
+
+StatusType ChainTask(TaskType tarea) {
+   return (E_OK);
+}
+
+StatusType TerminateTask(void) {
+   return (E_OK);
+}
+
+StatusType GetTaskID(TaskType * tarea) {
+   *tarea = actual;
+   return (E_OK);
+}
+
+StatusType SetEvent(TaskType tarea, EventMaskType mascara) {
+   if (tarea >= TASKS_COUNT) {
+      Fallar("SetEvent a una tarea inexistente");
+   }
+   eventos[tarea] |= mascara;
+   return (E_OK);
+}
+
+StatusType ClearEvent(EventMaskType mascara) {
+   eventos[actual] &= ~mascara;
+   return (E_OK);
+}
+
+StatusType WaitEvent(EventMaskType mascara) {
+   while (!(eventos[actual] & mascara)) {
+      if (!SimuladorPaso()) {
+         Fallar("la tarea espera un evento que nunca llega");
+      }
+   }
+   return (E_OK);
+}
+
+StatusType Schedule(void) {
+   /* No hay otras tareas que ejecutar, solo avanza la simulación */
+   if (!SimuladorPaso()) {
+      Fallar("la tarea cede el procesador sin nada pendiente en la simulación");
+   }
+   return (E_OK);
+}
+
+StatusType GetResource(ResourceType recurso) {
+   return (E_OK);
+}
+
+StatusType ReleaseResource(ResourceType recurso) {
+   return (E_OK);
+}
+
+StatusType SetRelAlarm(AlarmType alarma, TickType desplazamiento, TickType ciclo) {
+   StatusType resultado = E_OK;
+
+   if (alarma == Agrupar) {
+      if (agrupar_activa) {
+         Fallar("la alarma Agrupar se arranca mientras esta corriendo");
+      }
+      agrupar_activa = TRUE;
+      fin_agrupar = simulador.ahora + (uint64_t) desplazamiento * config.reloj / 1000;
+   }
+   return (resultado);
+}
+
+StatusType CancelAlarm(AlarmType alarma) {
+   return (E_OK);
+}
+
+StatusType GetAlarm(AlarmType alarma, TickType * restante) {
+   *restante = 0;
+   return (E_OK);
+}
+
+void StartOS(AppModeType modo) {
+}
+
+void ShutdownOS(StatusType error) {
+   Fallar("el sistema operativo se detuvo por un error");
+}
+
+void SuspendAllInterrupts(void) {
+   suspendidas++;
+}
+
+void ResumeAllInterrupts(void) {
+   suspendidas--;
+   Atender();
+}
+
+void SuspendOSInterrupts(void) {
+   SuspendAllInterrupts();
+}
+
+void ResumeOSInterrupts(void) {
+   ResumeAllInterrupts();
+}
+
+/* === Ciere de documentacion ============================================== */
+
+/** @} Final de la definición del modulo para doxygen */
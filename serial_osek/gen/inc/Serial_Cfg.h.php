@@ -0,0 +1,163 @@
+/* Copyright 2026, Gustavo Sosa - UTN FRT
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+<?php
+/** @file Serial_Cfg.h.php
+ **
+ ** @brief Plantilla de la configuración de los puertos seriales
+ **
+ ** El generador de FreeOSEK procesa esta plantilla con el archivo OIL del
+ ** proyecto y escribe Serial_Cfg.h en la carpeta de archivos generados. Cada
+ ** puerto serial corresponde a una rutina de servicio con un nombre conocido,
+ ** y su uart, interrupción, reloj y conexión de DMA se obtienen del atributo
+ ** INTERRUPT. La tarea que procesa las tramas recibidas es la que declara el
+ ** evento del puerto. Los problemas de la configuración se informan con
+ ** directivas error en el archivo generado.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  2 | 2026.10.14 | gsosa       | Aviso del coprocesador Cortex-M0        |
+ ** |  1 | 2026.10.14 | gsosa       | Version inicial del archivo             |
+ */
+
+/* Puertos de serial.c, con el nombre de su rutina de servicio y su evento */
+$puertos = array(
+   "CONSOLA" => array("rutina" => "EventoSerial", "evento" => "Recibido"),
+   "RS485" => array("rutina" => "EventoRs485", "evento" => "RecibidoRs485"),
+   "RS232" => array("rutina" => "EventoRs232", "evento" => "RecibidoRs232"),
+);
+
+/* Recursos de cada uart del LPC4337 */
+$uarts = array(
+   "UART0" => array("uart" => "LPC_USART0", "irq" => "USART0_IRQn",
+      "reloj" => "CLK_APB0_UART0", "dma" => "GPDMA_CONN_UART0_Tx"),
+   "UART2" => array("uart" => "LPC_USART2", "irq" => "USART2_IRQn",
+      "reloj" => "CLK_APB2_UART2", "dma" => "GPDMA_CONN_UART2_Tx"),
+   "UART3" => array("uart" => "LPC_USART3", "irq" => "USART3_IRQn",
+      "reloj" => "CLK_APB2_UART3", "dma" => "GPDMA_CONN_UART3_Tx"),
+);
+
+$isrs = $this->config->getList("/OSEK", "ISR");
+$tareas = $this->config->getList("/OSEK", "TASK");
+$alarmas = $this->config->getList("/OSEK", "ALARM");
+?>
+#ifndef SERIAL_CFG_H    /*! @cond    */
+#define SERIAL_CFG_H    /*! @endcond */
+
+/** @file Serial_Cfg.h
+ **
+ ** @brief Configuración de los puertos seriales generada desde el archivo OIL
+ **
+ ** Archivo generado por FreeOSEK a partir de gen/inc/Serial_Cfg.h.php, no se
+ ** debe modificar. Para cada puerto SERIAL_CFG_<puerto> indica si el OIL
+ ** declara su rutina de servicio y el resto de las macros describen la uart,
+ ** la prioridad de la rutina y la tarea y el evento de la recepción.
+ **
+ ** @addtogroup ejemplos
+ ** @{
+ */
+
+/* === Definicion y Macros ================================================= */
+<?php
+foreach ($puertos as $puerto => $datos) {
+   $encontrada = FALSE;
+   foreach ($isrs as $isr) {
+      if ($isr == $datos["rutina"]) {
+         $encontrada = TRUE;
+      }
+   }
+   print "\n//! Puerto " . $puerto . " atendido por la rutina " . $datos["rutina"] . "\n";
+   if (!$encontrada) {
+      print "#define SERIAL_CFG_" . $puerto . "    0\n";
+      continue;
+   }
+   $interrupcion = $this->config->getValue("/OSEK/" . $datos["rutina"], "INTERRUPT");
+   $prioridad = $this->config->getValue("/OSEK/" . $datos["rutina"], "PRIORITY");
+   $tarea = "";
+   foreach ($tareas as $candidata) {
+      foreach ($this->config->getList("/OSEK/" . $candidata, "EVENT") as $evento) {
+         if ($evento == $datos["evento"]) {
+            $tarea = $candidata;
+         }
+      }
+   }
+   print "#define SERIAL_CFG_" . $puerto . "    1\n";
+   if (!isset($uarts[$interrupcion])) {
+      print "#error \"La rutina " . $datos["rutina"] . " no atiende una uart\"\n";
+      continue;
+   }
+   if ($tarea == "") {
+      print "#error \"Ninguna tarea declara el evento " . $datos["evento"] . "\"\n";
+      continue;
+   }
+   foreach ($uarts[$interrupcion] as $campo => $valor) {
+      printf("#define SERIAL_CFG_%s_%-10s %s\n", $puerto, strtoupper($campo), $valor);
+   }
+   printf("#define SERIAL_CFG_%s_%-10s %s\n", $puerto, "PRIORIDAD", $prioridad);
+   printf("#define SERIAL_CFG_%s_%-10s %s\n", $puerto, "TAREA", $tarea);
+   printf("#define SERIAL_CFG_%s_%-10s %s\n", $puerto, "EVENTO", $datos["evento"]);
+}
+
+$prioridad = "";
+foreach ($isrs as $isr) {
+   if ($this->config->getValue("/OSEK/" . $isr, "INTERRUPT") == "DMA") {
+      $prioridad = $this->config->getValue("/OSEK/" . $isr, "PRIORITY");
+   }
+}
+print "\n//! Prioridad de la rutina de servicio del DMA, cero si no esta declarada\n";
+print "#define SERIAL_CFG_DMA_PRIORIDAD    " . ($prioridad == "" ? "0" : $prioridad) . "\n";
+
+$agrupar = 0;
+foreach ($alarmas as $alarma) {
+   if ($alarma == "Agrupar") {
+      $agrupar = 1;
+   }
+}
+print "\n//! Indica si el OIL declara la alarma Agrupar\n";
+print "#define SERIAL_CFG_AGRUPAR          " . $agrupar . "\n";
+
+$prioridad = "";
+foreach ($isrs as $isr) {
+   if (($isr == "EventoCoprocesador")
+      && ($this->config->getValue("/OSEK/" . $isr, "INTERRUPT") == "M0APP")) {
+      $prioridad = $this->config->getValue("/OSEK/" . $isr, "PRIORITY");
+   }
+}
+print "\n//! Indica si el OIL declara la rutina EventoCoprocesador del aviso del M0\n";
+print "#define SERIAL_CFG_COPROCESADOR     " . ($prioridad == "" ? "0" : "1") . "\n";
+print "#define SERIAL_CFG_COPROCESADOR_PRIORIDAD  " . ($prioridad == "" ? "0" : $prioridad) . "\n";
+?>
+
+/* === Ciere de documentacion ============================================== */
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* SERIAL_CFG_H */
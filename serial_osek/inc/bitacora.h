@@ -0,0 +1,167 @@
+/* Copyright 2026, Gustavo Sosa - UTN FRT
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef BITACORA_H    /*! @cond    */
+#define BITACORA_H    /*! @endcond */
+
+/** @file bitacora.h
+ **
+ ** @brief Bitacora binaria con formateo diferido
+ **
+ ** Registro de mensajes de la aplicación sin convertir los valores en texto.
+ ** Cada llamada a @ref BITACORA guarda en una cola un identificador de
+ ** dieciseis bits, formado con el numero de archivo @ref BITACORA_ARCHIVO y la
+ ** linea de la llamada, y los argumentos como palabras de 32 bits. Los
+ ** registros se envian por la uart en el tiempo ocioso y el programa
+ ** tools/bitacora.py los convierte en texto con la tabla de cadenas que arma
+ ** a partir de los fuentes. Si @ref SERIAL_BITACORA vale cero las llamadas se
+ ** reemplazan por @ref EnviarFormato y se envia el texto ya formateado.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2026.10.14 | gsosa       | Version inicial del archivo             |
+ **
+ ** @addtogroup ejemplos
+ ** @{
+ */
+
+/* === Inclusiones de archivos externos ==================================== */
+#include <stdint.h>
+#include <stdbool.h>
+#include "formato.h"
+
+/* === Cabecera C++ ======================================================== */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros ================================================= */
+
+/** @brief Habilita la bitacora binaria
+ **
+ ** Se puede definir en el Makefile del proyecto para enviar los mensajes de
+ ** @ref BITACORA como registros binarios en lugar de texto.
+ */
+#ifndef SERIAL_BITACORA
+   #define SERIAL_BITACORA    0
+#endif
+
+//! Tipo de los registros de la bitacora, a continuación de los de la traza
+#define BITACORA_REGISTRO     0xA4
+
+//! Identificador del registro con la cantidad de mensajes perdidos
+#define BITACORA_PERDIDOS     0
+
+//! Cantidad maxima de argumentos de un mensaje
+#define BITACORA_ARGUMENTOS_MAXIMO 4
+
+//! Bits del identificador que ocupa el numero de linea
+#define BITACORA_BITS_LINEA   12
+
+/** @brief Identificador de un mensaje en el archivo y la linea actuales
+ **
+ ** Cada archivo que usa @ref BITACORA debe definir BITACORA_ARCHIVO con un
+ ** numero distinto entre 1 y 15 antes de incluir este archivo, y las lineas
+ ** de las llamadas no pueden superar la 4095.
+ */
+#define BITACORA_IDENTIFICADOR \
+   ((uint16_t) ((BITACORA_ARCHIVO << BITACORA_BITS_LINEA) | (__LINE__ & 0x0FFF)))
+
+#if SERIAL_BITACORA
+   /** @brief Registra un mensaje con formato en la bitacora
+    **
+    ** El formato admite las especificaciones %d, %i, %u, %x, %X, %c, %q y %%
+    ** de @ref EnviarFormato, pero no %s, y hasta
+    ** @ref BITACORA_ARGUMENTOS_MAXIMO valores. La cadena no se guarda en la
+    ** memoria del programa y se debe escribir como un literal en la misma
+    ** linea que la llamada para que tools/bitacora.py la encuentre.
+    */
+   #define BITACORA(formato, ...) do { \
+      const uint32_t argumentos_[] = { 0, ##__VA_ARGS__ }; \
+      BitacoraRegistrar(BITACORA_IDENTIFICADOR, &argumentos_[1], \
+         sizeof(argumentos_) / sizeof(argumentos_[0]) - 1); \
+   } while (0)
+#else
+   #define BITACORA(formato, ...) ((void) EnviarFormato(formato, ##__VA_ARGS__))
+#endif
+
+/* == Declaraciones de tipos de datos ====================================== */
+
+/** @brief Estructura de datos de la cabecera de un registro de la bitacora
+ **
+ ** Los registros se envian por la uart tal cual estan en memoria, la cabecera
+ ** seguida por los argumentos, con los campos de mas de un byte en little
+ ** endian. Todos los registros ocupan un multiplo de cuatro bytes.
+ */
+typedef struct {
+   uint8_t tipo;                 /** < Siempre @ref BITACORA_REGISTRO */
+   uint8_t cantidad;             /** < Cantidad de argumentos */
+   uint16_t identificador;       /** < Archivo y linea del mensaje */
+} registro_bitacora_t;
+
+/* === Declaraciones de variables externas ================================= */
+
+/* === Declaraciones de funciones externas ================================= */
+
+/** @brief Inicializa la cola de registros de la bitacora
+ */
+void BitacoraIniciar(void);
+
+/** @brief Agrega un mensaje a la bitacora
+ **
+ ** Se puede llamar desde las tareas y desde las rutinas de servicio, en
+ ** general a través de la macro @ref BITACORA. Si la cola esta llena el mensaje
+ ** se descarta y se informa despues con un registro @ref BITACORA_PERDIDOS.
+ **
+ ** @param[in] identificador Identificador del mensaje.
+ ** @param[in] argumentos Valores del mensaje.
+ ** @param[in] cantidad Cantidad de valores, se descartan los que exceden
+ **            @ref BITACORA_ARGUMENTOS_MAXIMO.
+ */
+void BitacoraRegistrar(uint16_t identificador, const uint32_t * argumentos, uint8_t cantidad);
+
+/** @brief Envia por la uart los registros pendientes de la bitacora
+ **
+ ** Se llama desde la tarea de menor prioridad y entrega a la cola de
+ ** transmisión registros completos hasta @ref BITACORA_ENVIO_MAXIMO bytes.
+ **
+ ** @return Indica si se encolaron registros para transmitir.
+ */
+bool BitacoraEnviar(void);
+
+/* === Ciere de documentacion ============================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* BITACORA_H */
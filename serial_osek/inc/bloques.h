@@ -0,0 +1,115 @@
+/* Copyright 2026, Gustavo Sosa - UTN FRT
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef BLOQUES_H    /*! @cond    */
+#define BLOQUES_H    /*! @endcond */
+
+/** @file bloques.h
+ **
+ ** @brief Reserva de bloques de memoria de tamaño fijo
+ **
+ ** Conjunto estatico de bloques de memoria para los mensajes de transmisión. Los
+ ** bloques libres se guardan en una cola de indices, por lo que pedir y devolver
+ ** un bloque son operaciones de tiempo constante sin recorrer ninguna lista. La
+ ** cola tiene un solo productor, que devuelve bloques, y un solo consumidor, que
+ ** los pide, por lo que no necesita deshabilitar interrupciones.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2026.10.14 | gsosa       | Version inicial del archivo             |
+ **
+ ** @addtogroup ejemplos
+ ** @{
+ */
+
+/* === Inclusiones de archivos externos ==================================== */
+#include <stdint.h>
+
+/* === Cabecera C++ ======================================================== */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros ================================================= */
+
+/** @brief Cantidad de bloques de la reserva
+ **
+ ** Debe ser una potencia de dos y como maximo 256.
+ */
+#ifndef BLOQUES_CANTIDAD
+   #define BLOQUES_CANTIDAD   8
+#endif
+
+//! Cantidad de bytes de cada bloque
+#ifndef BLOQUES_TAMANIO
+   #define BLOQUES_TAMANIO    128
+#endif
+
+/* == Declaraciones de tipos de datos ====================================== */
+
+/* === Declaraciones de variables externas ================================= */
+
+/* === Declaraciones de funciones externas ================================= */
+
+/** @brief Inicializa la reserva con todos los bloques libres
+ */
+void BloquesIniciar(void);
+
+/** @brief Pide un bloque libre de la reserva
+ **
+ ** Las llamadas no se pueden interrumpir entre si, por lo que las tareas la
+ ** deben llamar con un recurso tomado.
+ **
+ ** @return Puntero al bloque o NULL si no hay bloques libres.
+ */
+void * BloquePedir(void);
+
+/** @brief Devuelve un bloque a la reserva
+ **
+ ** Las llamadas no se pueden interrumpir entre si, por lo que si la llaman
+ ** las tareas y las rutinas de servicio se deben suspender las interrupciones.
+ **
+ ** @param[in] bloque Puntero obtenido con @ref BloquePedir.
+ */
+void BloqueDevolver(void * bloque);
+
+/** @brief Cantidad de bloques libres en la reserva
+ */
+uint32_t BloquesLibres(void);
+
+/* === Ciere de documentacion ============================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* BLOQUES_H */
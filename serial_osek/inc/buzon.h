@@ -0,0 +1,118 @@
+/* Copyright 2026, Gustavo Sosa - UTN FRT
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef BUZON_H    /*! @cond    */
+#define BUZON_H    /*! @endcond */
+
+/** @file buzon.h
+ **
+ ** @brief Buzon en memoria compartida con el coprocesador Cortex-M0
+ **
+ ** Describe la memoria compartida entre el Cortex-M4, que ejecuta FreeOSEK, y
+ ** el Cortex-M0 del LPC4337 cuando el coprocesador atiende la uart de la
+ ** consola. Las colas de transmisión siguen en la memoria del M4, que es su
+ ** unico productor, y el coprocesador es su unico consumidor. Los bytes
+ ** recibidos viajan en sentido contrario por una cola propia. Cada nucleo avisa
+ ** al otro con la instrucción SEV, que en el LPC4337 genera la interrupción
+ ** entre nucleos.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  3 | 2026.10.14 | gsosa       | Lote compartido de la transmisión       |
+ ** |  2 | 2026.10.14 | gsosa       | Limites entre los mensajes normales     |
+ ** |  1 | 2026.10.14 | gsosa       | Version inicial del archivo             |
+ **
+ ** @addtogroup ejemplos
+ ** @{
+ */
+
+/* === Inclusiones de archivos externos ==================================== */
+#include <stdint.h>
+#include "chip.h"
+#include "cola.h"
+#include "lote.h"
+
+/* === Cabecera C++ ======================================================== */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros ================================================= */
+
+//! Valor que indica que el M4 completó el descriptor del buzon
+#define BUZON_FIRMA           0x4E5A5542
+
+/** @brief Dirección del descriptor del buzon
+ **
+ ** Las imagenes de los dos nucleos se enlazan por separado, por lo que el
+ ** descriptor ocupa una dirección fija que ambas conocen. Por defecto es el
+ ** inicio del segundo banco de la SRAM AHB, que el archivo de enlace del M4
+ ** no debe usar y donde el del coprocesador ubica sus variables despues
+ ** del descriptor.
+ */
+#ifndef BUZON_DIRECCION
+   #define BUZON_DIRECCION    0x20008000
+#endif
+
+//! Descriptor del buzon en la memoria compartida
+#define BUZON                 ((buzon_t *) BUZON_DIRECCION)
+
+/* == Declaraciones de tipos de datos ====================================== */
+
+/** @brief Descriptor del buzon entre los nucleos
+ **
+ ** El M4 completa todos los campos y por ultimo escribe la firma, antes de
+ ** liberar al coprocesador del reset. Las colas de recepción guardan dos
+ ** bytes por cada caracter, el registro de estado de la linea y el dato.
+ ** Las colas de transmisión y los limites entre los mensajes normales se
+ ** pasan en el @ref lote_t de la consola, que el M4 registra y el coprocesador
+ ** consume con las mismas funciones de lote.c que la rutina de servicio del M4.
+ */
+typedef struct {
+   volatile uint32_t firma;      /** < @ref BUZON_FIRMA con el descriptor completo */
+   LPC_USART_T * uart;           /** < Uart que atiende el coprocesador */
+   lote_t * lote;                /** < Colas de transmisión normal y urgente */
+   cola_t * recepcion;           /** < Caracteres recibidos con su estado */
+   volatile uint32_t perdidos;   /** < Caracteres que no entraron en la recepción */
+} buzon_t;
+
+/* === Declaraciones de variables externas ================================= */
+
+/* === Declaraciones de funciones externas ================================= */
+
+/* === Ciere de documentacion ============================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* BUZON_H */
@@ -0,0 +1,216 @@
+/* Copyright 2026, Gustavo Sosa - UTN FRT
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef COLA_H    /*! @cond    */
+#define COLA_H    /*! @endcond */
+
+/** @file cola.h
+ **
+ ** @brief Cola circular de bytes sin bloqueos
+ **
+ ** Cola circular de un productor y un consumidor para pasar datos entre una
+ ** tarea y una rutina de servicio de interrupción. Los indices son contadores
+ ** libres que solo modifica su dueño, por lo que no hace falta suspender las
+ ** interrupciones para acceder a la cola.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  5 | 2026.10.14 | gsosa       | Funciones de las rutinas en la RAM      |
+ ** |  4 | 2026.10.14 | gsosa       | Lectura de datos sin retirarlos         |
+ ** |  3 | 2026.10.14 | gsosa       | Copia de cadenas sin medirlas antes     |
+ ** |  2 | 2026.10.14 | gsosa       | Escritura de la cola en dos etapas      |
+ ** |  1 | 2026.10.14 | gsosa       | Version inicial del archivo             |
+ **
+ ** @addtogroup ejemplos
+ ** @{
+ */
+
+/* === Inclusiones de archivos externos ==================================== */
+#include <stdint.h>
+#include "memoria.h"
+
+/* === Cabecera C++ ======================================================== */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros ================================================= */
+
+/** @brief Verifica que un tamaño de cola sea una potencia de dos
+ **
+ ** @param[in] tamanio Cantidad de bytes del bloque de memoria de la cola.
+ */
+#define COLA_TAMANIO_VALIDO(tamanio)   ((tamanio) && !((tamanio) & ((tamanio) - 1)))
+
+/* == Declaraciones de tipos de datos ====================================== */
+
+/** @brief Estructura de datos de una cola circular
+ **
+ ** El productor solo escribe el campo entrada y el consumidor solo escribe el
+ ** campo salida. Ambos contadores avanzan sin limite y la posición en el
+ ** bloque se obtiene con la mascara, por lo que la diferencia entre ambos es
+ ** siempre la cantidad de bytes almacenados.
+ */
+typedef struct {
+   uint8_t * datos;              /** < Bloque de memoria de la cola */
+   uint32_t mascara;             /** < Tamaño del bloque menos uno */
+   volatile uint32_t entrada;    /** < Cantidad de bytes escritos */
+   volatile uint32_t salida;     /** < Cantidad de bytes leidos */
+} cola_t;
+
+/* === Declaraciones de variables externas ================================= */
+
+/* === Declaraciones de funciones externas ================================= */
+
+/** @brief Inicializa una cola vacia
+ **
+ ** @param[out] cola Puntero a la cola que se inicializa.
+ ** @param[in] bloque Bloque de memoria donde se almacenan los datos.
+ ** @param[in] tamanio Tamaño del bloque, debe ser una potencia de dos.
+ */
+void ColaIniciar(cola_t * cola, uint8_t * bloque, uint32_t tamanio);
+
+/** @brief Cantidad de bytes almacenados en la cola
+ **
+ ** @param[in] cola Puntero a la cola.
+ ** @return Cantidad de bytes pendientes de lectura.
+ */
+EN_RAM uint32_t ColaOcupada(const cola_t * cola);
+
+/** @brief Cantidad de bytes libres en la cola
+ **
+ ** @param[in] cola Puntero a la cola.
+ ** @return Cantidad de bytes que se pueden escribir.
+ */
+EN_RAM uint32_t ColaLibre(const cola_t * cola);
+
+/** @brief Escribe un bloque de datos en la cola
+ **
+ ** Esta función solo la puede llamar el productor. Los datos quedan visibles
+ ** para el consumidor cuando se publica el nuevo valor de entrada, después
+ ** de copiarlos.
+ **
+ ** @param[in] cola Puntero a la cola.
+ ** @param[in] datos Puntero a los datos que se escriben.
+ ** @param[in] cantidad Cantidad de bytes a escribir.
+ ** @return Cantidad de bytes escritos, menor a la solicitada si no hay lugar.
+ */
+uint32_t ColaEscribir(cola_t * cola, const void * datos, uint32_t cantidad);
+
+/** @brief Copia datos en el espacio libre de la cola sin publicarlos
+ **
+ ** Esta función solo la puede llamar el productor y permite armar un bloque
+ ** de datos en varias etapas directamente en la memoria de la cola. Los datos
+ ** no son visibles para el consumidor hasta llamar a @ref ColaPublicar.
+ **
+ ** @param[in] cola Puntero a la cola.
+ ** @param[in] desplazamiento Posición de los datos a partir de la entrada.
+ ** @param[in] datos Puntero a los datos que se copian.
+ ** @param[in] cantidad Cantidad de bytes a copiar.
+ ** @return Cantidad de bytes copiados, menor a la solicitada si no hay lugar.
+ */
+EN_RAM uint32_t ColaCopiar(cola_t * cola, uint32_t desplazamiento, const void * datos, uint32_t cantidad);
+
+/** @brief Copia una cadena en el espacio libre de la cola sin publicarla
+ **
+ ** Esta función es equivalente a @ref ColaCopiar pero recorre la cadena una
+ ** sola vez, copiando hasta encontrar el caracter nulo o llenar la cola.
+ **
+ ** @param[in] cola Puntero a la cola.
+ ** @param[in] desplazamiento Posición de los datos a partir de la entrada.
+ ** @param[in] cadena Puntero a la cadena que se copia.
+ ** @return Cantidad de caracteres copiados, la cadena se copió completa si
+ **         el caracter en esa posición es el nulo.
+ */
+uint32_t ColaCopiarTexto(cola_t * cola, uint32_t desplazamiento, const char * cadena);
+
+/** @brief Publica los datos copiados previamente en la cola
+ **
+ ** @param[in] cola Puntero a la cola.
+ ** @param[in] cantidad Cantidad de bytes que se entregan al consumidor.
+ */
+EN_RAM void ColaPublicar(cola_t * cola, uint32_t cantidad);
+
+/** @brief Obtiene el bloque contiguo de datos pendientes de lectura
+ **
+ ** Esta función solo la puede llamar el consumidor y permite leer los datos
+ ** directamente desde la memoria de la cola. Los datos no se retiran hasta
+ ** llamar a la función @ref ColaDescartar.
+ **
+ ** @param[in] cola Puntero a la cola.
+ ** @param[out] datos Puntero al primer byte pendiente de lectura.
+ ** @return Cantidad de bytes contiguos que se pueden leer.
+ */
+EN_RAM uint32_t ColaBloque(const cola_t * cola, const uint8_t ** datos);
+
+/** @brief Retira datos de la cola
+ **
+ ** Esta función solo la puede llamar el consumidor y libera el espacio de
+ ** datos leidos previamente con la función @ref ColaBloque.
+ **
+ ** @param[in] cola Puntero a la cola.
+ ** @param[in] cantidad Cantidad de bytes que se retiran.
+ */
+EN_RAM void ColaDescartar(cola_t * cola, uint32_t cantidad);
+
+/** @brief Copia datos pendientes de lectura sin retirarlos de la cola
+ **
+ ** Esta función solo la puede llamar el consumidor y permite examinar datos
+ ** que pueden estar partidos al final del bloque de memoria de la cola.
+ **
+ ** @param[in] cola Puntero a la cola.
+ ** @param[in] desplazamiento Posición de los datos a partir de la salida.
+ ** @param[out] datos Puntero donde se copian los datos.
+ ** @param[in] cantidad Cantidad maxima de bytes a copiar.
+ ** @return Cantidad de bytes copiados, menor a la solicitada si la cola no
+ **         tiene tantos datos.
+ */
+uint32_t ColaConsultar(const cola_t * cola, uint32_t desplazamiento, void * datos, uint32_t cantidad);
+
+/** @brief Lee un bloque de datos de la cola
+ **
+ ** Esta función solo la puede llamar el consumidor.
+ **
+ ** @param[in] cola Puntero a la cola.
+ ** @param[out] datos Puntero donde se copian los datos leidos.
+ ** @param[in] cantidad Cantidad maxima de bytes a leer.
+ ** @return Cantidad de bytes leidos.
+ */
+uint32_t ColaLeer(cola_t * cola, void * datos, uint32_t cantidad);
+
+/* === Ciere de documentacion ============================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* COLA_H */
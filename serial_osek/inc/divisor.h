@@ -0,0 +1,118 @@
+/* Copyright 2026, Gustavo Sosa - UTN FRT
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef DIVISOR_H    /*! @cond    */
+#define DIVISOR_H    /*! @endcond */
+
+/** @file divisor.h
+ **
+ ** @brief Calculo de los divisores de velocidad de una uart
+ **
+ ** Busqueda de los valores de los registros DLL, DLM y FDR de una uart del
+ ** LPC43xx que dan la velocidad mas cercana a la pedida. La velocidad que se
+ ** obtiene es reloj / (16 * divisor * (1 + DIVADDVAL / MULVAL)), por lo que el
+ ** divisor fraccional permite velocidades de hasta 3 Mbaudios con errores
+ ** menores que los del divisor entero solo.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2026.10.14 | gsosa       | Version inicial del archivo             |
+ **
+ ** @addtogroup ejemplos
+ ** @{
+ */
+
+/* === Inclusiones de archivos externos ==================================== */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Cabecera C++ ======================================================== */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros ================================================= */
+
+/** @brief Error maximo aceptado en la velocidad, en partes por mil
+ **
+ ** El receptor tolera alrededor de un 4% de diferencia total entre los dos
+ ** extremos, por lo que cada uno puede aportar la mitad de ese margen.
+ */
+#ifndef DIVISOR_TOLERANCIA
+   #define DIVISOR_TOLERANCIA    20
+#endif
+
+/* == Declaraciones de tipos de datos ====================================== */
+
+/** @brief Valores de los divisores de velocidad de una uart
+ */
+typedef struct {
+   uint16_t latch;               /** < Divisor entero, DLM en la parte alta y DLL en la baja */
+   uint8_t suma;                 /** < Campo DIVADDVAL del registro FDR */
+   uint8_t multiplicador;        /** < Campo MULVAL del registro FDR */
+} divisor_t;
+
+/* === Declaraciones de variables externas ================================= */
+
+/* === Declaraciones de funciones externas ================================= */
+
+/** @brief Calcula los divisores para una velocidad
+ **
+ ** Recorre todas las fracciones validas del registro FDR y para cada una
+ ** redondea el divisor entero, respetando que el divisor debe ser al menos 3
+ ** cuando DIVADDVAL es distinto de cero. Se elige la combinación con menor
+ ** error y ante errores iguales la de menor fracción.
+ **
+ ** @param[in] reloj Frecuencia del reloj de la uart en Hz.
+ ** @param[in] baudios Velocidad pedida.
+ ** @param[out] divisor Valores de los divisores de la mejor combinación.
+ ** @return Indica si el error de la mejor combinación es como maximo
+ **         @ref DIVISOR_TOLERANCIA, en caso contrario no se modifica el
+ **         divisor.
+ */
+bool DivisorCalcular(uint32_t reloj, uint32_t baudios, divisor_t * divisor);
+
+/** @brief Velocidad que se obtiene con unos divisores
+ **
+ ** @param[in] reloj Frecuencia del reloj de la uart en Hz.
+ ** @param[in] divisor Valores de los divisores.
+ ** @return Velocidad en baudios, redondeada al entero mas cercano.
+ */
+uint32_t DivisorBaudios(uint32_t reloj, const divisor_t * divisor);
+
+/* === Ciere de documentacion ============================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* DIVISOR_H */
@@ -0,0 +1,138 @@
+/* Copyright 2026, Gustavo Sosa - UTN FRT
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FORMATO_H    /*! @cond    */
+#define FORMATO_H    /*! @endcond */
+
+/** @file formato.h
+ **
+ ** @brief Formateo de mensajes en la cola de transmisión
+ **
+ ** Funciones para armar mensajes de texto con valores numericos directamente
+ ** en el espacio reservado de la cola de transmisión, sin memoria dinamica ni
+ ** buffers intermedios en la pila de la tarea que transmite. Las funciones son
+ ** reentrantes y el acceso a la cola se serializa con el recurso RecursoSerial.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  2 | 2026.10.14 | gsosa       | Limites documentados de los campos      |
+ ** |  1 | 2026.10.14 | gsosa       | Version inicial del archivo             |
+ **
+ ** @addtogroup ejemplos
+ ** @{
+ */
+
+/* === Inclusiones de archivos externos ==================================== */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Cabecera C++ ======================================================== */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros ================================================= */
+
+//! Ancho maximo de un valor numerico formateado, incluyendo el relleno
+#define FORMATO_ANCHO_MAXIMO  16
+
+//! Cantidad maxima de cifras decimales de un valor de coma fija
+#define FORMATO_DECIMALES_MAXIMO 9
+
+/* == Declaraciones de tipos de datos ====================================== */
+
+//! Tipos de valores que se pueden formatear
+typedef enum {
+   FORMATO_TEXTO = 0,         /** < Sin valor, solo el texto fijo */
+   FORMATO_ENTERO,            /** < Entero con signo en decimal */
+   FORMATO_NATURAL,           /** < Entero sin signo en decimal */
+   FORMATO_HEXA,              /** < Entero sin signo en hexadecimal */
+   FORMATO_HEXA_MAYUSCULAS,   /** < Entero sin signo en hexadecimal */
+   FORMATO_FIJO,              /** < Entero con signo escalado en coma fija */
+} formato_tipo_t;
+
+/** @brief Estructura de datos de un campo de una plantilla
+ **
+ ** Una plantilla es una lista de campos ya interpretados que se envia con la
+ ** función @ref EnviarPlantilla, evitando analizar una cadena de formato en
+ ** cada mensaje con una estructura fija. El texto se puede inicializar con la
+ ** macro @ref LITERAL. Un ancho mayor que @ref FORMATO_ANCHO_MAXIMO o mas
+ ** decimales que @ref FORMATO_DECIMALES_MAXIMO se recortan a esos limites.
+ */
+typedef struct {
+   const char * texto;        /** < Texto fijo que precede al valor */
+   uint8_t longitud;          /** < Cantidad de caracteres del texto fijo */
+   uint8_t tipo;              /** < Tipo del valor, ver @ref formato_tipo_t */
+   uint8_t ancho;             /** < Ancho minimo del valor, hasta @ref FORMATO_ANCHO_MAXIMO */
+   uint8_t decimales;         /** < Cifras decimales, hasta @ref FORMATO_DECIMALES_MAXIMO */
+   char relleno;              /** < Caracter de relleno, espacio o cero */
+} campo_t;
+
+/* === Declaraciones de variables externas ================================= */
+
+/* === Declaraciones de funciones externas ================================= */
+
+/** @brief Envio de un mensaje con formato
+ **
+ ** Esta función arma el mensaje directamente en la cola de transmisión con
+ ** un subconjunto de las especificaciones de printf: %d, %i, %u, %x, %X, %c,
+ ** %s y %%, con relleno de ceros y ancho minimo opcionales. Ademas %q formatea
+ ** un entero con signo en coma fija, y la precisión indica la cantidad de
+ ** cifras decimales, por ejemplo %.2q con el valor 1234 envia 12.34. El
+ ** mensaje se encola completo o no se encola, igual que @ref EnviarBloque.
+ **
+ ** @param[in] formato Cadena con el texto fijo y las especificaciones.
+ ** @param[in] ... Valores para cada especificación del formato.
+ ** @return Indica si el mensaje se encoló.
+ */
+bool EnviarFormato(const char * formato, ...);
+
+/** @brief Envio de un mensaje con una plantilla
+ **
+ ** Esta función es equivalente a @ref EnviarFormato pero usa una plantilla
+ ** ya interpretada, por lo que solo convierte los valores.
+ **
+ ** @param[in] campos Lista de campos de la plantilla.
+ ** @param[in] cantidad Cantidad de campos de la plantilla.
+ ** @param[in] valores Lista con un valor para cada campo, el valor de los
+ **            campos de tipo @ref FORMATO_TEXTO se ignora.
+ ** @return Indica si el mensaje se encoló.
+ */
+bool EnviarPlantilla(const campo_t * campos, uint8_t cantidad, const int32_t * valores);
+
+/* === Ciere de documentacion ============================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* FORMATO_H */
@@ -0,0 +1,156 @@
+/* Copyright 2026, Gustavo Sosa - UTN FRT
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef LOTE_H    /*! @cond    */
+#define LOTE_H    /*! @endcond */
+
+/** @file lote.h
+ **
+ ** @brief Intercalado de los avisos urgentes con los mensajes normales
+ **
+ ** Politica que reparte la FIFO de transmisión entre la cola normal y la cola
+ ** de avisos urgentes de un puerto. Los avisos salen en lotes que solo
+ ** empiezan en un limite entre mensajes normales y que toman los avisos
+ ** encolados en ese momento, y despues de cada lote los datos normales
+ ** avanzan hasta el proximo limite antes de que empiece otro. La usan la
+ ** rutina de servicio del M4 y el programa del coprocesador, que recibe el
+ ** lote de la consola en el buzon.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2026.10.14 | gsosa       | Version inicial del archivo             |
+ **
+ ** @addtogroup ejemplos
+ ** @{
+ */
+
+/* === Inclusiones de archivos externos ==================================== */
+#include <stdint.h>
+#include <stdbool.h>
+#include "memoria.h"
+#include "cola.h"
+
+/* === Cabecera C++ ======================================================== */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros ================================================= */
+
+/** @brief Indica si hay un lote de avisos urgentes en curso
+ **
+ ** @param[in] lote Puntero al lote.
+ */
+#define LOTE_URGENTE(lote)    ((lote)->urgente->salida != (lote)->fin)
+
+/* == Declaraciones de tipos de datos ====================================== */
+
+/** @brief Estructura de datos del intercalado de las colas de un puerto
+ **
+ ** Los limites son las posiciones de la cola normal donde termina cada
+ ** mensaje. Las tareas solo escriben el campo entrada y la rutina de
+ ** servicio el resto, igual que en @ref cola_t. Sin tabla de limites los
+ ** avisos se intercalan al inicio de cualquier tramo y pueden partir un
+ ** mensaje normal.
+ */
+typedef struct {
+   cola_t * normal;              /** < Cola de los mensajes normales */
+   cola_t * urgente;             /** < Cola de los avisos urgentes */
+   uint32_t * limites;           /** < Fines de los mensajes, NULL sin limites */
+   uint32_t mascara;             /** < Cantidad de limites menos uno */
+   volatile uint32_t entrada;    /** < Limites registrados por las tareas */
+   volatile uint32_t salida;     /** < Limites alcanzados por la rutina */
+   uint32_t fin;                 /** < Salida urgente al terminar el lote */
+   bool cediendo;                /** < Se envian datos normales antes de otro lote */
+} lote_t;
+
+/* === Declaraciones de variables externas ================================= */
+
+/* === Declaraciones de funciones externas ================================= */
+
+/** @brief Inicializa el intercalado de las colas de un puerto
+ **
+ ** @param[out] lote Puntero al lote que se inicializa.
+ ** @param[in] normal Cola de los mensajes normales.
+ ** @param[in] urgente Cola de los avisos urgentes.
+ ** @param[in] limites Tabla de limites, NULL para no respetar los mensajes.
+ ** @param[in] cantidad Cantidad de limites de la tabla, debe ser una
+ **            potencia de dos.
+ */
+void LoteIniciar(lote_t * lote, cola_t * normal, cola_t * urgente,
+   uint32_t * limites, uint32_t cantidad);
+
+/** @brief Registra el fin de un mensaje normal
+ **
+ ** Esta función solo la puede llamar el productor de la cola normal, antes
+ ** de publicar los datos del mensaje. Si la tabla esta completa el mensaje
+ ** se une al anterior.
+ **
+ ** @param[in] lote Puntero al lote.
+ ** @param[in] posicion Entrada de la cola normal despues del mensaje.
+ */
+void LoteRegistrar(lote_t * lote, uint32_t posicion);
+
+/** @brief Indica si la salida de la cola normal esta en un limite de mensajes
+ **
+ ** @param[in] lote Puntero al lote.
+ ** @return Indica si se puede intercalar un lote de avisos urgentes.
+ */
+EN_RAM bool LoteLimite(const lote_t * lote);
+
+/** @brief Obtiene el siguiente tramo contiguo de una de las colas
+ **
+ ** Empieza un lote de avisos urgentes si corresponde. El tramo es el resto
+ ** del lote en curso o los datos de la cola normal hasta el proximo limite,
+ ** lo que se puede consultar con @ref LOTE_URGENTE.
+ **
+ ** @param[in] lote Puntero al lote.
+ ** @param[out] datos Puntero al inicio del tramo.
+ ** @return Cantidad de bytes del tramo, cero si no hay datos pendientes.
+ */
+EN_RAM uint32_t LoteTramo(lote_t * lote, const uint8_t ** datos);
+
+/** @brief Descarta los bytes transmitidos del tramo actual
+ **
+ ** @param[in] lote Puntero al lote.
+ ** @param[in] cantidad Cantidad de bytes que se retiran de la cola del
+ **            tramo, como maximo la informada por @ref LoteTramo.
+ */
+EN_RAM void LoteDescartar(lote_t * lote, uint32_t cantidad);
+
+/* === Ciere de documentacion ============================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* LOTE_H */
@@ -0,0 +1,132 @@
+/* Copyright 2026, Gustavo Sosa - UTN FRT
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef MEDICION_H    /*! @cond    */
+#define MEDICION_H    /*! @endcond */
+
+/** @file medicion.h
+ **
+ ** @brief Medición de tiempos de ejecución con el contador de ciclos
+ **
+ ** Sondas para medir duraciones en ciclos de reloj con el contador CYCCNT de la
+ ** unidad DWT del Cortex-M4. Cada medición acumula el minimo, el maximo y el
+ ** promedio de las duraciones registradas. Si @ref SERIAL_MEDICION vale cero
+ ** todas las macros se reemplazan por nada y no tienen ningun costo.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2026.10.14 | gsosa       | Version inicial del archivo             |
+ **
+ ** @addtogroup ejemplos
+ ** @{
+ */
+
+/* === Inclusiones de archivos externos ==================================== */
+#include <stdint.h>
+
+/* === Cabecera C++ ======================================================== */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros ================================================= */
+
+/** @brief Habilita las sondas de medición de tiempos
+ **
+ ** Se puede definir en el Makefile del proyecto para habilitar la medición
+ ** de los tiempos de la transmisión serial.
+ */
+#ifndef SERIAL_MEDICION
+   #define SERIAL_MEDICION    0
+#endif
+
+#if SERIAL_MEDICION
+   //! Declara una variable con el valor actual del contador de ciclos
+   #define MEDICION_INICIO(marca)   uint32_t marca = MedicionMarca()
+
+   //! Registra en una medición los ciclos transcurridos desde una marca
+   #define MEDICION_REGISTRAR(medicion, marca) \
+      MedicionRegistrar((medicion), MedicionMarca() - (marca))
+#else
+   #define MEDICION_INICIO(marca)
+   #define MEDICION_REGISTRAR(medicion, marca)
+#endif
+
+/* == Declaraciones de tipos de datos ====================================== */
+
+/** @brief Estructura de datos de una medición
+ **
+ ** Cada medición debe tener un solo escritor o estar protegida por un
+ ** recurso, ya que los campos se actualizan por separado.
+ */
+typedef struct {
+   uint32_t minimo;              /** < Menor duración registrada en ciclos */
+   uint32_t maximo;              /** < Mayor duración registrada en ciclos */
+   uint32_t cuenta;              /** < Cantidad de duraciones registradas */
+   uint64_t suma;                /** < Suma de las duraciones registradas */
+} medicion_t;
+
+/* === Declaraciones de variables externas ================================= */
+
+/* === Declaraciones de funciones externas ================================= */
+
+/** @brief Habilita el contador de ciclos de la unidad DWT
+ */
+void MedicionIniciar(void);
+
+/** @brief Valor actual del contador de ciclos
+ **
+ ** @return Cantidad de ciclos de reloj desde @ref MedicionIniciar.
+ */
+uint32_t MedicionMarca(void);
+
+/** @brief Registra una duración en una medición
+ **
+ ** @param[in] medicion Puntero a la medición.
+ ** @param[in] ciclos Duración en ciclos de reloj.
+ */
+void MedicionRegistrar(medicion_t * medicion, uint32_t ciclos);
+
+/** @brief Promedio de las duraciones registradas en una medición
+ **
+ ** @param[in] medicion Puntero a la medición.
+ ** @return Duración promedio en ciclos, cero si no hay registros.
+ */
+uint32_t MedicionPromedio(const medicion_t * medicion);
+
+/* === Ciere de documentacion ============================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* MEDICION_H */
@@ -0,0 +1,103 @@
+/* Copyright 2026, Gustavo Sosa - UTN FRT
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef MEMORIA_H    /*! @cond    */
+#define MEMORIA_H    /*! @endcond */
+
+/** @file memoria.h
+ **
+ ** @brief Ubicación en la memoria RAM del codigo de las rutinas de servicio
+ **
+ ** Macros para ejecutar desde la RAM local las funciones de la transmisión y la
+ ** recepción que usan las rutinas de servicio. La flash interna del LPC4337
+ ** necesita estados de espera a 204 MHz, que el acelerador de la flash solo
+ ** oculta en el codigo secuencial, mientras que la RAM local no tiene estados de
+ ** espera. Las colas de los puertos ya estan en la RAM local porque el script de
+ ** enlace ubica ahi la sección .bss.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2026.10.14 | gsosa       | Version inicial del archivo             |
+ **
+ ** @addtogroup ejemplos
+ ** @{
+ */
+
+/* === Inclusiones de archivos externos ==================================== */
+#include <stdint.h>
+
+/* === Cabecera C++ ======================================================== */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros ================================================= */
+
+/** @brief Ejecuta desde la RAM el codigo de las rutinas de servicio
+ **
+ ** Se puede definir en el Makefile del proyecto. No depende del atributo
+ ** MEMMAP del archivo OIL, que en FreeOSEK solo agrupa el codigo del sistema
+ ** operativo con las macros de Os_MemMap.h y no lo mueve de la flash en el
+ ** puerto para Cortex-M, por lo que se mantiene en FALSE.
+ */
+#ifndef SERIAL_MEMMAP
+   #define SERIAL_MEMMAP      0
+#endif
+
+#if SERIAL_MEMMAP && defined(__arm__)
+   /** @brief Ubica una función en la RAM local
+    **
+    ** El script de enlace de LPCXpresso incluye las secciones .ramfunc en la
+    ** sección .data, por lo que el codigo de inicio las copia desde la flash
+    ** junto con las variables inicializadas. Las llamadas a estas funciones se
+    ** compilan como llamadas largas porque la RAM local esta a mas de 16 MB de
+    ** la flash. Se debe usar en la declaración para que la vean todas las
+    ** llamadas.
+    */
+   #define EN_RAM             __attribute__((section(".ramfunc"), long_call))
+#else
+   #define EN_RAM
+#endif
+
+/* == Declaraciones de tipos de datos ====================================== */
+
+/* === Declaraciones de variables externas ================================= */
+
+/* === Declaraciones de funciones externas ================================= */
+
+/* === Ciere de documentacion ============================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* MEMORIA_H */
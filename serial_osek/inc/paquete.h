@@ -0,0 +1,136 @@
+/* Copyright 2026, Gustavo Sosa - UTN FRT
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PAQUETE_H    /*! @cond    */
+#define PAQUETE_H    /*! @endcond */
+
+/** @file paquete.h
+ **
+ ** @brief Paquetes binarios con codificación COBS y CRC
+ **
+ ** Capa de paquetes sobre la transmisión y la recepción serial. Cada paquete
+ ** lleva los datos seguidos de un CRC-CCITT de 16 bits calculado por el motor
+ ** de CRC del LPC43xx y se codifica con COBS, por lo que no contiene bytes nulos
+ ** y termina con el delimitador @ref PAQUETE_DELIMITADOR. La codificación se
+ ** hace en una sola pasada directamente en la cola de transmisión, sin copias
+ ** intermedias, y agrega como maximo un byte cada 254 mas el delimitador.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2026.10.14 | gsosa       | Version inicial del archivo             |
+ **
+ ** @addtogroup ejemplos
+ ** @{
+ */
+
+/* === Inclusiones de archivos externos ==================================== */
+#include <stdint.h>
+#include <stdbool.h>
+#include "serial.h"
+
+/* === Cabecera C++ ======================================================== */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros ================================================= */
+
+//! Byte que termina cada paquete codificado
+#define PAQUETE_DELIMITADOR   0x00
+
+//! Cantidad de bytes del CRC al final de los datos de cada paquete
+#define PAQUETE_CRC           2
+
+/** @brief Cantidad maxima de bytes de un paquete codificado
+ **
+ ** Incluye los bytes de codigo de COBS, el CRC y el delimitador.
+ **
+ ** @param[in] cantidad Cantidad de bytes de datos del paquete.
+ */
+#define PAQUETE_MAXIMO(cantidad) \
+   ((cantidad) + PAQUETE_CRC + ((cantidad) + PAQUETE_CRC) / 254 + 2)
+
+/* == Declaraciones de tipos de datos ====================================== */
+
+/* === Declaraciones de variables externas ================================= */
+
+/* === Declaraciones de funciones externas ================================= */
+
+/** @brief Habilita el reloj del motor de CRC
+ */
+void PaquetesIniciar(void);
+
+/** @brief Envio de un paquete formado por varios fragmentos
+ **
+ ** Reserva lugar para el peor caso de la codificación con
+ ** @ref ReservarPuerto y codifica los fragmentos y el CRC directamente en la
+ ** cola de transmisión del puerto. El paquete se encola completo o no se
+ ** encola, con las mismas reglas que @ref EnviarFragmentos.
+ **
+ ** @param[in] puerto Puerto por el que se envia el paquete.
+ ** @param[in] fragmentos Lista de fragmentos en el orden de envio.
+ ** @param[in] cantidad Cantidad de fragmentos de la lista.
+ ** @return Indica si el paquete se encoló.
+ */
+bool EnviarPaqueteFragmentos(puerto_serial_t puerto, const fragmento_t * fragmentos,
+   uint8_t cantidad);
+
+/** @brief Envio de un paquete binario
+ **
+ ** @param[in] puerto Puerto por el que se envia el paquete.
+ ** @param[in] datos Puntero a los datos del paquete.
+ ** @param[in] cantidad Cantidad de bytes de datos.
+ ** @return Indica si el paquete se encoló.
+ */
+bool EnviarPaquete(puerto_serial_t puerto, const void * datos, uint32_t cantidad);
+
+/** @brief Decodifica un paquete recibido y verifica su CRC
+ **
+ ** La decodificación se hace sobre la misma trama, que se recibe sin el
+ ** delimitador separando las tramas con @ref PAQUETE_DELIMITADOR. Usa el
+ ** motor de CRC, por lo que toma el recurso RecursoSerial y no se puede
+ ** llamar con una reserva en curso.
+ **
+ ** @param[in,out] trama Trama recibida, al retornar contiene los datos.
+ ** @param[in] cantidad Cantidad de bytes de la trama.
+ ** @return Cantidad de bytes de datos, cero si la trama no es un paquete
+ **         valido o no tiene datos.
+ */
+uint32_t PaqueteDecodificar(uint8_t * trama, uint32_t cantidad);
+
+/* === Ciere de documentacion ============================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* PAQUETE_H */
@@ -0,0 +1,108 @@
+/* Copyright 2026, Gustavo Sosa - UTN FRT
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PILA_H    /*! @cond    */
+#define PILA_H    /*! @endcond */
+
+/** @file pila.h
+ **
+ ** @brief Medición del uso de las pilas de las tareas
+ **
+ ** Antes de arrancar el sistema operativo se llenan las pilas de todas las tareas
+ ** con un patrón conocido. Como las pilas crecen hacia las direcciones bajas, la
+ ** cantidad de bytes que conservan el patrón desde el inicio de cada pila indica
+ ** cuanto nunca se usó, y la diferencia con su tamaño es su marca de agua.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2026.10.14 | gsosa       | Version inicial del archivo             |
+ **
+ ** @addtogroup ejemplos
+ ** @{
+ */
+
+/* === Inclusiones de archivos externos ==================================== */
+#include <stdint.h>
+#include "os.h"
+
+/* === Cabecera C++ ======================================================== */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros ================================================= */
+
+/** @brief Habilita la medición del uso de las pilas
+ **
+ ** Se puede definir en el Makefile del proyecto para pintar las pilas antes
+ ** de StartOS y atender el comando que informa su uso por la uart.
+ */
+#ifndef SERIAL_PILAS
+   #define SERIAL_PILAS       0
+#endif
+
+//! Valor con el que se llenan las pilas sin usar
+#define PILA_PATRON           0xA5
+
+/* == Declaraciones de tipos de datos ====================================== */
+
+/* === Declaraciones de variables externas ================================= */
+
+/* === Declaraciones de funciones externas ================================= */
+
+/** @brief Llena las pilas de todas las tareas con el patrón
+ **
+ ** Se debe llamar antes de StartOS, cuando ninguna tarea usa su pila.
+ */
+void PilaPintar(void);
+
+/** @brief Tamaño de la pila de una tarea
+ **
+ ** @param[in] tarea Identificador de la tarea.
+ ** @return Cantidad de bytes asignados a la pila en el archivo OIL.
+ */
+uint32_t PilaTamanio(TaskType tarea);
+
+/** @brief Maxima cantidad de bytes usados de la pila de una tarea
+ **
+ ** @param[in] tarea Identificador de la tarea.
+ ** @return Cantidad de bytes de la pila que no conservan el patrón.
+ */
+uint32_t PilaUsada(TaskType tarea);
+
+/* === Ciere de documentacion ============================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* PILA_H */
@@ -47,6 +47,16 @@
  ** 
  ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
  ** |----|------------|-------------|-----------------------------------------|
+ ** | 12 | 2026.10.14 | gsosa       | Estadisticas de los puertos             |
+ ** | 11 | 2026.10.14 | gsosa       | Nivel de disparo de la recepción        |
+ ** | 10 | 2026.10.14 | gsosa       | Despacho de los mensajes agrupados      |
+ ** |  9 | 2026.10.14 | gsosa       | Corrección de datos en la reserva       |
+ ** |  8 | 2026.10.14 | gsosa       | Cambio de velocidad de los puertos      |
+ ** |  7 | 2026.10.14 | gsosa       | Varios puertos seriales independientes  |
+ ** |  6 | 2026.10.14 | gsosa       | Avisos de transmisión completa          |
+ ** |  5 | 2026.10.14 | gsosa       | Cola de transmisión para avisos urgentes|
+ ** |  4 | 2026.10.14 | gsosa       | Mensajes en bloques de memoria propios  |
+ ** |  3 | 2026.10.14 | gsosa       | Interface de transmisión para modulos   |
  ** |  2 | 2017.10.21 | evolentini  | Correción en el formato del archivo     |
  ** |  1 | 2017.09.16 | evolentini  | Version inicial del archivo             |
  ** 
@@ -56,6 +66,9 @@
  */
 
 /* === Inclusiones de archivos externos ==================================== */
+#include <stdint.h>
+#include <stdbool.h>
+#include "os.h"
 
 /* === Cabecera C++ ======================================================== */
 #ifdef __cplusplus
@@ -64,12 +77,445 @@ extern "C" {
 
 /* === Definicion y Macros ================================================= */
 
+/** @brief Argumentos de puntero y longitud para una cadena literal
+ **
+ ** Permite enviar una cadena literal con @ref EnviarBloque o @ref EnviarDatos
+ ** sin recorrerla, ya que su longitud se calcula al compilar. La
+ ** concatenación con cadenas vacias impide usarla con un puntero.
+ */
+#define LITERAL(cadena)    ("" cadena ""), (sizeof(cadena) - 1)
+
+/** @brief Habilita el puerto RS-485 en la uart 0
+ **
+ ** El puerto usa el transceptor de la placa y la salida U0_DIR controla la
+ ** dirección del mismo durante la transmisión.
+ */
+#ifndef SERIAL_RS485
+#define SERIAL_RS485       0
+#endif
+
+/** @brief Habilita el puerto RS-232 en la uart 3 */
+#ifndef SERIAL_RS232
+#define SERIAL_RS232       0
+#endif
+
+/** @brief Habilita los contadores de estadisticas de los puertos
+ **
+ ** Los contadores se leen con @ref LeerEstadisticas o con el comando
+ ** "estadisticas" de la consola.
+ */
+#ifndef SERIAL_ESTADISTICAS
+#define SERIAL_ESTADISTICAS   1
+#endif
+
 /* == Declaraciones de tipos de datos ====================================== */
 
+/** @brief Estructura de datos de un fragmento de mensaje
+ **
+ ** Un mensaje armado por partes, como una cabecera, los datos y un codigo de
+ ** verificación, se describe con una lista de fragmentos que se envian con
+ ** la función @ref EnviarFragmentos. Se puede inicializar con la macro
+ ** @ref LITERAL.
+ */
+typedef struct {
+   const void * datos;           /** < Puntero a los datos del fragmento */
+   uint32_t cantidad;            /** < Cantidad de bytes del fragmento */
+} fragmento_t;
+
+/** @brief Función que se llama cuando se completa una transmisión
+ **
+ ** Se ejecuta en el contexto de la rutina de servicio, por lo que debe ser
+ ** breve y solo puede usar los servicios del sistema operativo permitidos en
+ ** las interrupciones de categoria 2.
+ **
+ ** @param[in] parametro Valor indicado al registrar el aviso.
+ */
+typedef void (*completo_t)(void * parametro);
+
+/** @brief Puertos seriales manejados por el modulo
+ **
+ ** Cada puerto tiene sus propias colas, configuración de FIFO y rutina de
+ ** servicio. Las funciones que no reciben el puerto usan la consola, que es
+ ** la uart conectada a la interface de depuracion USB.
+ */
+typedef enum {
+   PUERTO_CONSOLA,               /** < Uart de la interface de depuracion USB */
+#if SERIAL_RS485
+   PUERTO_RS485,                 /** < Uart 0 con el transceptor RS-485 */
+#endif
+#if SERIAL_RS232
+   PUERTO_RS232,                 /** < Uart 3 con el conector RS-232 */
+#endif
+   PUERTOS_CANTIDAD              /** < Cantidad de puertos habilitados */
+} puerto_serial_t;
+
+/** @brief Contadores de estadisticas de un puerto serial
+ **
+ ** Cada contador tiene un solo escritor, la rutina de servicio del puerto o
+ ** las tareas con el recurso RecursoSerial tomado, y se actualiza con una
+ ** escritura de una palabra, por lo que se leen sin bloquear. Los contadores
+ ** se incrementan modulo 2^32.
+ */
+typedef struct {
+   uint32_t enviados;            /** < Bytes entregados a la uart */
+   uint32_t recibidos;           /** < Bytes leidos de la uart */
+   uint32_t interrupciones;      /** < Atenciones de la rutina de servicio */
+   uint32_t desbordes;           /** < Bytes perdidos por la FIFO de recepción llena */
+   uint32_t errores_paridad;     /** < Bytes recibidos con error de paridad */
+   uint32_t errores_formato;     /** < Bytes recibidos sin el bit de parada */
+   uint32_t cortes;              /** < Condiciones de corte en la linea */
+   uint32_t tramas_descartadas;  /** < Tramas que no entraron en la cola de recepción */
+   uint32_t maximo_recepcion;    /** < Mayor ocupación de la cola de recepción */
+   uint32_t maximo_transmision;  /** < Mayor ocupación de la cola de transmisión */
+   uint32_t rechazados;          /** < Escrituras rechazadas por falta de lugar */
+   uint32_t esperas;             /** < Esperas de las tareas por la transmisión */
+   uint32_t tiempo_espera;       /** < Duración total de las esperas en microsegundos */
+} estadisticas_t;
+
+/** @brief Nivel de disparo de la FIFO de recepción de un puerto
+ **
+ ** Con un nivel bajo cada byte recibido se procesa enseguida y con uno alto
+ ** la uart interrumpe una vez cada varios bytes. Los bytes que no alcanzan
+ ** el nivel se entregan igual por el tiempo de espera entre caracteres, pero
+ ** recien cuatro caracteres despues del ultimo. En el modo adaptativo el
+ ** nivel sube un paso cada vez que la FIFO lo alcanza y vuelve al minimo
+ ** cuando la interrupción se produce por el tiempo de espera, es decir
+ ** cuando la linea queda libre.
+ */
+typedef enum {
+   DISPARO_1_BYTE = 0,           /** < Interrupción con cada byte */
+   DISPARO_4_BYTES,              /** < Interrupción cada 4 bytes */
+   DISPARO_8_BYTES,              /** < Interrupción cada 8 bytes */
+   DISPARO_14_BYTES,             /** < Interrupción cada 14 bytes */
+   DISPARO_ADAPTATIVO,           /** < Nivel segun el trafico recibido */
+} disparo_t;
+
 /* === Declaraciones de variables externas ================================= */
 
 /* === Declaraciones de funciones externas ================================= */
 
+/** @brief Reserva espacio en la cola de transmisión
+ **
+ ** Esta función toma el recurso RecursoSerial, que serializa a las tareas
+ ** que transmiten, y verifica que la cola tenga lugar para los datos. Si la
+ ** reserva es exitosa el recurso queda tomado hasta llamar a la función
+ ** @ref ConfirmarReserva o @ref CancelarReserva, por lo que los datos se
+ ** deben copiar sin demoras. Mientras el recurso esta tomado todo el espacio
+ ** libre de la cola queda disponible para la reserva.
+ **
+ ** @param[in] cantidad Cantidad minima de bytes que se reservan.
+ ** @return Indica si se reservó el espacio, en caso contrario el recurso se
+ **         libera antes de retornar.
+ */
+bool ReservarEspacio(uint32_t cantidad);
+
+/** @brief Reserva espacio en la cola de transmisión de un puerto
+ **
+ ** Es equivalente a @ref ReservarEspacio pero para cualquier puerto. Las
+ ** funciones @ref EscribirReserva, @ref EscribirTexto, @ref ConfirmarReserva
+ ** y @ref CancelarReserva actuan sobre el puerto reservado.
+ **
+ ** @param[in] puerto Puerto en el que se reserva el espacio.
+ ** @param[in] cantidad Cantidad minima de bytes que se reservan.
+ ** @return Indica si se reservó el espacio.
+ */
+bool ReservarPuerto(puerto_serial_t puerto, uint32_t cantidad);
+
+/** @brief Copia datos en el espacio reservado de la cola de transmisión
+ **
+ ** @param[in] datos Puntero a los datos que se copian.
+ ** @param[in] cantidad Cantidad de bytes, se descartan los que exceden el
+ **            espacio reservado con @ref ReservarEspacio.
+ ** @return Indica si los datos entraron completos en el espacio reservado.
+ */
+bool EscribirReserva(const void * datos, uint32_t cantidad);
+
+/** @brief Copia una cadena en el espacio reservado de la cola de transmisión
+ **
+ ** @param[in] cadena Puntero a la cadena que se copia sin el caracter nulo.
+ ** @return Indica si la cadena entró completa en el espacio reservado.
+ */
+bool EscribirTexto(const char * cadena);
+
+/** @brief Cantidad de bytes copiados en la reserva en curso
+ **
+ ** @return Posición en la reserva del proximo byte que se copia.
+ */
+uint32_t EscritosReserva(void);
+
+/** @brief Reemplaza datos ya copiados en la reserva en curso
+ **
+ ** Permite completar una cabecera o un codigo cuyo valor se conoce despues de
+ ** copiar los datos que le siguen, sin armar el mensaje en otra memoria.
+ **
+ ** @param[in] posicion Posición en la reserva del primer byte que se reemplaza.
+ ** @param[in] datos Puntero a los datos nuevos.
+ ** @param[in] cantidad Cantidad de bytes.
+ ** @return Indica si los bytes estaban copiados, en caso contrario no se
+ **         reemplaza ninguno.
+ */
+bool CorregirReserva(uint32_t posicion, const void * datos, uint32_t cantidad);
+
+/** @brief Descarta los datos reservados
+ **
+ ** Esta función libera el recurso tomado por @ref ReservarEspacio sin
+ ** entregar a la rutina de servicio los datos copiados en la reserva.
+ */
+void CancelarReserva(void);
+
+/** @brief Entrega los datos reservados a la rutina de servicio
+ **
+ ** Esta función publica los datos copiados con @ref EscribirReserva, libera
+ ** el recurso tomado por @ref ReservarEspacio e inicia la transmisión.
+ */
+void ConfirmarReserva(void);
+
+/** @brief Envio de un bloque de datos por puerto serial
+ **
+ ** Esta función copia un bloque de datos binarios en la cola de transmisión
+ ** de la uart conectada a la interface de depuracion USB y retorna
+ ** inmediatamente. El bloque se envia mediante interupciones utilizando la
+ ** función @ref EnviarCaracter en la rutina de servicio, que es el unico
+ ** consumidor de la cola. La pueden llamar varias tareas de distintas
+ ** prioridades y cada bloque se encola completo, sin mezclarse con los de
+ ** otras tareas.
+ **
+ ** @param[in] datos Puntero al bloque de datos a enviar.
+ ** @param[in] cantidad Cantidad de bytes del bloque.
+ ** @return Indica si el bloque se encoló, no se encola ningun byte si la
+ **         cola no tiene espacio para el bloque completo.
+ */
+bool EnviarBloque(const void * datos, uint32_t cantidad);
+
+/** @brief Envio de un bloque de datos por un puerto
+ **
+ ** Es equivalente a @ref EnviarBloque pero para cualquier puerto.
+ **
+ ** @param[in] puerto Puerto por el que se envia el bloque.
+ ** @param[in] datos Puntero al bloque de datos a enviar.
+ ** @param[in] cantidad Cantidad de bytes del bloque.
+ ** @return Indica si el bloque se encoló.
+ */
+bool EnviarPuerto(puerto_serial_t puerto, const void * datos, uint32_t cantidad);
+
+/** @brief Envio de un mensaje formado por varios fragmentos
+ **
+ ** Esta función copia todos los fragmentos en la cola de transmisión con una
+ ** sola reserva, por lo que el mensaje se transmite sin pausas entre las
+ ** partes y sin mezclarse con los datos de otras tareas, y una sola llamada
+ ** a @ref EsperarTransmision espera el final de todo el mensaje.
+ **
+ ** @param[in] fragmentos Lista de fragmentos en el orden de envio.
+ ** @param[in] cantidad Cantidad de fragmentos de la lista.
+ ** @return Indica si el mensaje se encoló, no se encola ningun fragmento si
+ **         la cola no tiene espacio para el mensaje completo.
+ */
+bool EnviarFragmentos(const fragmento_t * fragmentos, uint8_t cantidad);
+
+/** @brief Envio de una cadena por puerto serial
+ **
+ ** Esta función es equivalente a @ref EnviarBloque pero recibe una cadena
+ ** terminada en un caracter nulo, que se mide mientras se copia en la cola
+ ** recorriendola una sola vez. Para enviar cadenas literales sin recorrerlas
+ ** se puede usar @ref EnviarBloque con la macro @ref LITERAL.
+ **
+ ** @param[in] cadena Puntero con la cadena de caracteres a enviar.
+ ** @return Indica si la cadena se encoló, no se encola ningun caracter si
+ **         la cola no tiene espacio para la cadena completa.
+ */
+bool EnviarTexto(const char * cadena);
+
+/** @brief Envio de un bloque de datos de cualquier longitud
+ **
+ ** Esta función copia un bloque de datos binarios en la cola de transmisión
+ ** y espera solo cuando la cola no tiene lugar. Si el bloque entra en el
+ ** espacio libre se encola completo, en caso contrario se encola en partes
+ ** de al menos la mitad de la cola a medida que se libera espacio, y entre
+ ** las partes se pueden intercalar los datos de otras tareas. Solo la pueden
+ ** llamar las tareas extendidas que tienen asignado el evento Completo.
+ **
+ ** @param[in] datos Puntero al bloque de datos a enviar.
+ ** @param[in] cantidad Cantidad de bytes del bloque.
+ */
+void EnviarDatos(const void * datos, uint32_t cantidad);
+
+/** @brief Envio de un aviso urgente
+ **
+ ** Esta función copia el aviso en una cola de transmisión propia, que la
+ ** rutina de servicio atiende antes que los datos normales en el siguiente
+ ** limite entre mensajes, por lo que su demora no depende del volumen de los
+ ** datos normales encolados. El aviso se encola completo o no se encola y su
+ ** salida no genera el evento Completo, por lo que la pueden llamar también
+ ** las tareas básicas.
+ **
+ ** @param[in] datos Puntero al aviso a enviar.
+ ** @param[in] cantidad Cantidad de bytes del aviso.
+ ** @return Indica si el aviso se encoló.
+ */
+bool EnviarUrgente(const void * datos, uint32_t cantidad);
+
+/** @brief Pide un bloque de memoria para armar un mensaje
+ **
+ ** La tarea arma el mensaje directamente en el bloque, de hasta
+ ** @ref BLOQUES_TAMANIO bytes, y luego lo entrega para su transmisión con
+ ** @ref EntregarMensaje o lo libera con @ref LiberarMensaje.
+ **
+ ** @return Puntero al bloque o NULL si no hay bloques libres.
+ */
+void * PedirMensaje(void);
+
+/** @brief Entrega un mensaje armado en un bloque para su transmisión
+ **
+ ** El mensaje se transmite desde el bloque sin copiarlo en la cola, que
+ ** solo reserva un byte para mantener el orden con el resto de los datos.
+ ** Si se entrega el bloque pasa a ser propiedad de la rutina de servicio,
+ ** que lo libera al terminar la transmisión. Se puede esperar la salida del
+ ** mensaje con @ref EsperarTransmision.
+ **
+ ** @param[in] mensaje Bloque obtenido con @ref PedirMensaje.
+ ** @param[in] cantidad Cantidad de bytes del mensaje.
+ ** @return Indica si el mensaje se entregó, si la cola no tiene lugar la
+ **         tarea conserva el bloque.
+ */
+bool EntregarMensaje(void * mensaje, uint32_t cantidad);
+
+/** @brief Libera un bloque obtenido con @ref PedirMensaje sin transmitirlo
+ **
+ ** @param[in] mensaje Bloque obtenido con @ref PedirMensaje.
+ */
+void LiberarMensaje(void * mensaje);
+
+/** @brief Registra un aviso para cuando se transmitan los datos encolados
+ **
+ ** Esta función no bloquea a la tarea que la llama, cuando la rutina de
+ ** servicio retira de la cola de transmisión el ultimo byte encolado antes
+ ** de la llamada llama a la función y activa a la tarea indicadas. Permite a
+ ** las tareas básicas esperar la transmisión sin el evento Completo. Si los
+ ** datos ya se transmitieron el aviso se da en la siguiente atención de la
+ ** rutina de servicio. Cada aviso se da una sola vez.
+ **
+ ** @param[in] tarea Tarea que se activa o INVALID_TASK.
+ ** @param[in] funcion Función que se llama o NULL.
+ ** @param[in] parametro Valor que recibe la función.
+ ** @return Indica si se registró el aviso, falla si todos los lugares de
+ **         @ref SERIAL_AVISOS estan ocupados.
+ */
+bool AvisarTransmision(TaskType tarea, completo_t funcion, void * parametro);
+
+/** @brief Registra un aviso para cuando se transmitan los datos de un puerto
+ **
+ ** Es equivalente a @ref AvisarTransmision pero para cualquier puerto.
+ **
+ ** @param[in] puerto Puerto cuya transmisión se avisa.
+ ** @param[in] tarea Tarea que se activa o INVALID_TASK.
+ ** @param[in] funcion Función que se llama o NULL.
+ ** @param[in] parametro Valor que recibe la función.
+ ** @return Indica si se registró el aviso.
+ */
+bool AvisarPuerto(puerto_serial_t puerto, TaskType tarea, completo_t funcion, void * parametro);
+
+/** @brief Espera que la rutina de servicio retire datos de la cola
+ **
+ ** Esta función bloquea a la tarea que la llama hasta que el indice de
+ ** salida de la cola de transmisión alcanza el objetivo. Solo la pueden
+ ** llamar las tareas extendidas que tienen asignado el evento Completo y sin
+ ** el recurso RecursoSerial tomado.
+ **
+ ** @param[in] objetivo Valor del indice de salida que se espera.
+ */
+void EsperarSalida(uint32_t objetivo);
+
+/** @brief Espera que se transmitan los datos encolados por la tarea
+ **
+ ** Esta función bloquea a la tarea que la llama hasta que la rutina de
+ ** servicio retira de la cola de transmisión el ultimo byte encolado antes
+ ** de la llamada, con las mismas restricciones que @ref EsperarSalida.
+ */
+void EsperarTransmision(void);
+
+/** @brief Espera que se transmitan los datos encolados en un puerto
+ **
+ ** Es equivalente a @ref EsperarTransmision pero para cualquier puerto.
+ **
+ ** @param[in] puerto Puerto cuya transmisión se espera.
+ */
+void EsperarPuerto(puerto_serial_t puerto);
+
+/** @brief Lee una trama recibida por un puerto
+ **
+ ** La trama se retira de la cola de recepción del puerto, que la rutina de
+ ** servicio llena y que solo debe leer una tarea.
+ **
+ ** @param[in] puerto Puerto del que se lee la trama.
+ ** @param[out] datos Buffer donde se copia la trama.
+ ** @param[in] maximo Tamaño del buffer.
+ ** @return Cantidad de bytes de la trama o cero si no hay tramas completas.
+ */
+uint32_t RecibirPuerto(puerto_serial_t puerto, uint8_t * datos, uint32_t maximo);
+
+/** @brief Inicia la transmisión de los datos agrupados de un puerto
+ **
+ ** Cuando los mensajes cortos se agrupan con SERIAL_AGRUPAR_VENTANA los datos
+ ** pendientes salen sin esperar que termine la ventana. En otro caso no
+ ** tiene efecto porque cada mensaje inicia su transmisión.
+ **
+ ** @param[in] puerto Puerto que transmite.
+ */
+void DespacharPuerto(puerto_serial_t puerto);
+
+/** @brief Inicia la transmisión de los datos agrupados de la consola
+ */
+void DespacharTransmision(void);
+
+/** @brief Cambia la velocidad de un puerto
+ **
+ ** Calcula los divisores entero y fraccional de la uart con el menor error
+ ** para la velocidad pedida, hasta 3 Mbaudios con el reloj de 204 MHz. Los
+ ** datos encolados antes de la llamada se transmiten completos a la
+ ** velocidad anterior y durante el cambio el resto de las tareas no pueden
+ ** transmitir por ningun puerto. Los bytes recibidos durante el cambio se
+ ** pueden perder. Solo la pueden llamar las tareas extendidas que tienen
+ ** asignado el evento Completo y sin el recurso RecursoSerial tomado.
+ **
+ ** @param[in] puerto Puerto que cambia de velocidad.
+ ** @param[in] baudios Velocidad nueva.
+ ** @return Indica si se cambió la velocidad, falla sin modificar el puerto
+ **         si el error supera @ref DIVISOR_TOLERANCIA o si la uart la
+ **         atiende el coprocesador.
+ */
+bool CambiarBaudios(puerto_serial_t puerto, uint32_t baudios);
+
+/** @brief Velocidad actual de un puerto
+ **
+ ** @param[in] puerto Puerto que se consulta.
+ ** @return Velocidad pedida en la ultima configuración, en baudios.
+ */
+uint32_t BaudiosPuerto(puerto_serial_t puerto);
+
+/** @brief Cambia el nivel de disparo de la FIFO de recepción de un puerto
+ **
+ ** El cambio no vacia la FIFO, por lo que no se pierden bytes recibidos.
+ **
+ ** @param[in] puerto Puerto que se configura.
+ ** @param[in] disparo Nivel fijo o @ref DISPARO_ADAPTATIVO, que arranca en
+ **            el nivel minimo.
+ ** @return Indica si se cambió el nivel, falla si el valor no es valido o
+ **         si la uart la atiende el coprocesador.
+ */
+bool CambiarDisparo(puerto_serial_t puerto, disparo_t disparo);
+
+#if SERIAL_ESTADISTICAS
+/** @brief Copia los contadores de estadisticas de un puerto
+ **
+ ** Los contadores se copian de a uno mientras el puerto sigue funcionando,
+ ** por lo que dos campos pueden corresponder a momentos apenas distintos.
+ **
+ ** @param[in] puerto Puerto del que se leen las estadisticas.
+ ** @param[out] estadisticas Copia de los contadores del puerto.
+ */
+void LeerEstadisticas(puerto_serial_t puerto, estadisticas_t * estadisticas);
+#endif
+
 /* === Ciere de documentacion ============================================== */
 #ifdef __cplusplus
 }
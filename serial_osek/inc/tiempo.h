@@ -0,0 +1,113 @@
+/* Copyright 2026, Gustavo Sosa - UTN FRT
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef TIEMPO_H    /*! @cond    */
+#define TIEMPO_H    /*! @endcond */
+
+/** @file tiempo.h
+ **
+ ** @brief Tiempo transcurrido desde el arranque del sistema
+ **
+ ** Cuenta los segundos desde el arranque con la alarma PasoSegundo del contador
+ ** Segundero y completa la fracción del segundo actual con el contador de ciclos,
+ ** para obtener marcas de tiempo sin llamar al sistema operativo.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2026.10.14 | gsosa       | Version inicial del archivo             |
+ **
+ ** @addtogroup ejemplos
+ ** @{
+ */
+
+/* === Inclusiones de archivos externos ==================================== */
+#include <stdint.h>
+
+/* === Cabecera C++ ======================================================== */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros ================================================= */
+
+/* == Declaraciones de tipos de datos ====================================== */
+
+//! Estructura de datos de una marca de tiempo
+typedef struct {
+   uint32_t segundos;            /** < Segundos desde el arranque */
+   uint32_t microsegundos;       /** < Fracción del segundo actual */
+} tiempo_t;
+
+/* === Declaraciones de variables externas ================================= */
+
+/* === Declaraciones de funciones externas ================================= */
+
+/** @brief Inicia la cuenta del tiempo desde el arranque
+ **
+ ** Habilita el contador de ciclos que se usa para la fracción del segundo.
+ */
+void TiempoIniciar(void);
+
+/** @brief Registra el paso de un segundo
+ **
+ ** Esta función se llama desde la rutina de la alarma PasoSegundo cada vez
+ ** que el contador Segundero avanza.
+ */
+void TiempoPasoSegundo(void);
+
+/** @brief Segundos transcurridos desde el arranque
+ **
+ ** @return Cantidad de segundos completos.
+ */
+uint32_t TiempoSegundos(void);
+
+/** @brief Milisegundos transcurridos desde el arranque
+ **
+ ** @return Cantidad de milisegundos, se desborda a los 49 dias.
+ */
+uint32_t TiempoMilisegundos(void);
+
+/** @brief Marca de tiempo con resolución de microsegundos
+ **
+ ** Se puede llamar desde las tareas y las rutinas de servicio.
+ **
+ ** @param[out] tiempo Puntero donde se guarda el tiempo actual.
+ */
+void TiempoLeer(tiempo_t * tiempo);
+
+/* === Ciere de documentacion ============================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* TIEMPO_H */
@@ -0,0 +1,166 @@
+/* Copyright 2026, Gustavo Sosa - UTN FRT
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef TRAZA_H    /*! @cond    */
+#define TRAZA_H    /*! @endcond */
+
+/** @file traza.h
+ **
+ ** @brief Traza binaria de la ejecución de las tareas
+ **
+ ** Registro de los cambios de tarea y de las rutinas de servicio en una cola de
+ ** registros binarios de ocho bytes con la marca de tiempo del contador de
+ ** ciclos. Los registros se envian por la uart en el tiempo ocioso y se
+ ** decodifican en la computadora con el programa tools/traza.py. Si
+ ** @ref SERIAL_TRAZA vale cero las macros se reemplazan por nada.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2026.10.14 | gsosa       | Version inicial del archivo             |
+ **
+ ** @addtogroup ejemplos
+ ** @{
+ */
+
+/* === Inclusiones de archivos externos ==================================== */
+#include <stdint.h>
+#include <stdbool.h>
+#include "medicion.h"
+
+/* === Cabecera C++ ======================================================== */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definicion y Macros ================================================= */
+
+/** @brief Habilita la traza de ejecución de las tareas
+ **
+ ** Se puede definir en el Makefile del proyecto para enviar por la uart
+ ** los registros de los ganchos PreTaskHook y PostTaskHook.
+ */
+#ifndef SERIAL_TRAZA
+   #define SERIAL_TRAZA       0
+#endif
+
+//! Registro de la entrada de una tarea al procesador
+#define TRAZA_ENTRADA         0xA0
+
+//! Registro de la salida de una tarea del procesador
+#define TRAZA_SALIDA          0xA1
+
+//! Registro de la duración de una rutina de servicio
+#define TRAZA_INTERRUPCION    0xA2
+
+//! Registro de la cantidad de registros perdidos por falta de lugar
+#define TRAZA_PERDIDOS        0xA3
+
+#if SERIAL_TRAZA
+   //! Declara una variable con el momento de entrada a una rutina de servicio
+   #define TRAZA_INICIO(marca)   uint32_t marca = MedicionMarca()
+
+   //! Registra la duración de una rutina de servicio desde una marca
+   #define TRAZA_INTERRUPCION_FIN(rutina, marca) TrazaInterrupcion((rutina), (marca))
+#else
+   #define TRAZA_INICIO(marca)
+   #define TRAZA_INTERRUPCION_FIN(rutina, marca)
+#endif
+
+/* == Declaraciones de tipos de datos ====================================== */
+
+/** @brief Estructura de datos de un registro de la traza
+ **
+ ** Los registros se envian por la uart tal cual estan en memoria, con los
+ ** campos de mas de un byte en little endian. El tipo siempre tiene el bit
+ ** mas significativo en uno para separar los registros de los textos.
+ */
+typedef struct {
+   uint8_t tipo;                 /** < Tipo del registro, TRAZA_ENTRADA ... */
+   uint8_t identificador;        /** < Tarea o rutina de servicio */
+   uint16_t duracion;            /** < Ciclos de la rutina o registros perdidos */
+   uint32_t marca;               /** < Valor del contador de ciclos */
+} registro_traza_t;
+
+/* === Declaraciones de variables externas ================================= */
+
+/* === Declaraciones de funciones externas ================================= */
+
+/** @brief Inicializa la cola de registros de la traza
+ **
+ ** Tambien habilita el contador de ciclos que se usa para las marcas de
+ ** tiempo, por lo que se debe llamar antes del primer cambio de tarea.
+ */
+void TrazaIniciar(void);
+
+/** @brief Agrega un registro a la traza
+ **
+ ** Se puede llamar desde los ganchos del sistema operativo y desde las
+ ** rutinas de servicio. Si la cola esta llena el registro se descarta y se
+ ** informa despues con un registro @ref TRAZA_PERDIDOS.
+ **
+ ** @param[in] tipo Tipo del registro.
+ ** @param[in] identificador Tarea o rutina de servicio.
+ ** @param[in] duracion Valor del campo duración, se satura en 65535.
+ ** @param[in] marca Valor del contador de ciclos.
+ */
+void TrazaRegistrar(uint8_t tipo, uint8_t identificador, uint32_t duracion, uint32_t marca);
+
+/** @brief Registra la entrada o salida de la tarea actual
+ **
+ ** @param[in] tipo @ref TRAZA_ENTRADA desde PreTaskHook o @ref TRAZA_SALIDA
+ **            desde PostTaskHook.
+ */
+void TrazaTarea(uint8_t tipo);
+
+/** @brief Registra la duración de una rutina de servicio
+ **
+ ** @param[in] rutina Identificador de la rutina de servicio.
+ ** @param[in] marca Valor del contador de ciclos al entrar a la rutina.
+ */
+void TrazaInterrupcion(uint8_t rutina, uint32_t marca);
+
+/** @brief Envia por la uart los registros pendientes de la traza
+ **
+ ** Se llama desde la tarea de menor prioridad y entrega los registros a la
+ ** cola de transmisión en bloques de @ref TRAZA_ENVIO_MAXIMO bytes.
+ **
+ ** @return Indica si se encolaron registros para transmitir.
+ */
+bool TrazaEnviar(void);
+
+/* === Ciere de documentacion ============================================== */
+#ifdef __cplusplus
+}
+#endif
+
+/** @} Final de la definición del modulo para doxygen */
+
+#endif   /* TRAZA_H */
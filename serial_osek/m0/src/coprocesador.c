@@ -0,0 +1,288 @@
+/* Copyright 2026, Gustavo Sosa - UTN FRT
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file coprocesador.c
+ **
+ ** @brief Atención de la uart de la consola en el Cortex-M0
+ **
+ ** Programa del Cortex-M0 del LPC4337 para el modo SERIAL_COPROCESADOR de
+ ** serial.c. Espera el descriptor del @ref BUZON, atiende la interrupción de la
+ ** uart de la consola y vacia en la FIFO de transmisión la cola de avisos
+ ** urgentes y la cola normal, que las tareas del M4 llenan con las mismas
+ ** funciones de siempre. Los avisos urgentes se intercalan en lotes en los
+ ** limites entre los mensajes normales con las funciones de lote.c, las
+ ** mismas que usa la rutina de servicio del M4. Cada caracter recibido se pasa al M4 con su
+ ** registro de estado y el M4 arma las tramas. Despues de retirar o recibir
+ ** datos avisa al M4 con la instrucción SEV.
+ **
+ ** No usa el sistema operativo ni las bibliotecas de arranque, la tabla de
+ ** vectores y la inicialización de la memoria estan en este archivo. Se
+ ** compila por separado de la imagen del M4, por ejemplo con:
+ **
+ **     arm-none-eabi-gcc -mcpu=cortex-m0 -mthumb -Os -DCORE_M0 -nostartfiles
+ **        -Iinc -I<lpcopen>/lpc_chip_43xx/inc -Tm0/etc/coprocesador.ld
+ **        m0/src/coprocesador.c src/cola.c src/lote.c -o coprocesador.elf
+ **
+ ** y se graba en el banco B de la flash, en la dirección que indica
+ ** SERIAL_COPROCESADOR_IMAGEN en serial.c.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  4 | 2026.10.14 | gsosa       | Politica de lotes compartida con el M4  |
+ ** |  3 | 2026.10.14 | gsosa       | Lotes de avisos urgentes como en el M4  |
+ ** |  2 | 2026.10.14 | gsosa       | Respuesta a todos los avisos del M4     |
+ ** |  1 | 2026.10.14 | gsosa       | Version inicial del archivo             |
+ **
+ ** @addtogroup ejemplos
+ ** @{
+ */
+
+/* === Inclusiones de cabeceras ============================================ */
+#include <stdint.h>
+#include <stdbool.h>
+#include "chip.h"
+#include "cola.h"
+#include "lote.h"
+#include "buzon.h"
+
+/* === Definicion y Macros ================================================= */
+
+//! Cantidad de bytes que admite la FIFO de transmisión de la uart
+#define FIFO_TX_LONGITUD   16
+
+//! Cantidad de vectores de la tabla, los del procesador y 32 interrupciones
+#define VECTORES_CANTIDAD  (16 + 32)
+
+//! Numero de la interrupción que genera el M4 con la instrucción SEV
+#define INTERRUPCION_M4    1
+
+/* === Declaraciones de tipos de datos internos ============================ */
+
+//! Interrupción de cada uart en el NVIC del Cortex-M0
+typedef struct {
+   LPC_USART_T * uart;           /** < Uart */
+   uint8_t interrupcion;         /** < Numero de la interrupción en el M0 */
+} uart_m0_t;
+
+/* === Declaraciones de funciones internas ================================= */
+
+/** @brief Punto de entrada despues del reset
+ **
+ ** Copia los valores iniciales de las variables, borra las que no tienen
+ ** valor inicial y llama a la función principal.
+ */
+void Reiniciar(void);
+
+/** @brief Rutina de las excepciones e interrupciones que no se usan
+ */
+void Ignorar(void);
+
+/** @brief Rutina de servicio del aviso del M4
+ **
+ ** El M4 la activa despues de publicar datos en las colas de transmisión,
+ ** por lo que habilita la interrupción de transmisión de la uart y fuerza su
+ ** atención para arrancar la transmisión si la FIFO estaba vacia. Esa
+ ** atención responde con SEV aunque no retire datos.
+ */
+void AtenderM4(void);
+
+/** @brief Rutina de servicio de la uart de la consola
+ **
+ ** Pasa al M4 los caracteres recibidos, completa la FIFO de transmisión y
+ ** avisa al M4 si hubo cambios en alguna de las colas.
+ */
+void AtenderUart(void);
+
+/** @brief Completa la FIFO de transmisión con los datos de las colas
+ **
+ ** @return Cantidad de bytes retirados de las colas.
+ */
+uint32_t LlenarFifo(void);
+
+/** @brief Función principal del coprocesador
+ */
+int main(void);
+
+/* === Definiciones de variables internas ================================== */
+
+//! Interrupciones de las uarts del LPC4337 en el Cortex-M0
+const uart_m0_t uarts[] = {
+   { LPC_USART0, 24 }, { LPC_UART1, 25 }, { LPC_USART2, 26 }, { LPC_USART3, 27 },
+};
+
+//! Uart que atiende el coprocesador, copiada del descriptor
+LPC_USART_T * uart;
+
+//! Interrupción de la uart en el NVIC del Cortex-M0
+IRQn_Type interrupcion;
+
+/** @brief Indica que el M4 pidió atención desde la ultima respuesta
+ **
+ ** El M4 puede registrar un aviso cuando sus datos ya salieron de la cola,
+ ** por lo que cada pedido se responde con SEV aunque no haya datos nuevos.
+ */
+volatile bool pedido_m4;
+
+/* Simbolos definidos en el archivo de enlace */
+extern uint32_t _etext, _data, _edata, _bss, _ebss, _pila;
+
+//! Tabla de vectores, el M0 la lee al inicio de la imagen
+__attribute__((section(".vectores"), used))
+void (* const vectores[VECTORES_CANTIDAD])(void) = {
+   [2 ... VECTORES_CANTIDAD - 1] = Ignorar,
+   [0] = (void (*)(void)) &_pila,
+   [1] = Reiniciar,
+   [16 + INTERRUPCION_M4] = AtenderM4,
+   [16 + 24] = AtenderUart,
+   [16 + 25] = AtenderUart,
+   [16 + 26] = AtenderUart,
+   [16 + 27] = AtenderUart,
+};
+
+/* === Definiciones de variables externas ================================== */
+
+/* === Definiciones de funciones internas ================================== */
+
+void Reiniciar(void) {
+   uint32_t * origen = &_etext;
+   uint32_t * destino;
+
+   for (destino = &_data; destino < &_edata; destino++) {
+      *destino = *origen++;
+   }
+   for (destino = &_bss; destino < &_ebss; destino++) {
+      *destino = 0;
+   }
+   main();
+   while (TRUE) {
+      __WFI();
+   }
+}
+
+void Ignorar(void) {
+}
+
+void AtenderM4(void) {
+   LPC_CREG->M4TXEVENT = 0;
+   pedido_m4 = TRUE;
+   Chip_UART_IntEnable(uart, UART_IER_THREINT);
+   NVIC_SetPendingIRQ(interrupcion);
+}
+
+void AtenderUart(void) {
+   buzon_t * buzon = BUZON;
+   uint32_t estado;
+   uint8_t caracter[2];
+   bool avisar = pedido_m4;
+
+   estado = Chip_UART_ReadLineStatus(uart);
+   while (estado & UART_LSR_RDR) {
+      caracter[0] = estado;
+      caracter[1] = Chip_UART_ReadByte(uart);
+      /* El estado y el dato se publican juntos o ninguno */
+      if (ColaLibre(buzon->recepcion) >= sizeof(caracter)) {
+         ColaEscribir(buzon->recepcion, caracter, sizeof(caracter));
+      } else {
+         buzon->perdidos++;
+      }
+      avisar = TRUE;
+      estado = Chip_UART_ReadLineStatus(uart);
+   }
+
+   if ((Chip_UART_GetIntsEnabled(uart) & UART_IER_THREINT) && (estado & UART_LSR_THRE)) {
+      if (LlenarFifo() > 0) {
+         avisar = TRUE;
+      }
+      if ((ColaOcupada(buzon->lote->urgente) == 0) && (ColaOcupada(buzon->lote->normal) == 0)) {
+         Chip_UART_IntDisable(uart, UART_IER_THREINT);
+      }
+   }
+
+   pedido_m4 = FALSE;
+   if (avisar) {
+      /* Los indices de las colas quedan visibles antes del aviso */
+      __DSB();
+      __SEV();
+   }
+}
+
+uint32_t LlenarFifo(void) {
+   lote_t * lote = BUZON->lote;
+   const uint8_t * datos;
+   uint32_t cantidad;
+   uint32_t indice;
+   uint32_t libres = FIFO_TX_LONGITUD;
+
+   cantidad = LoteTramo(lote, &datos);
+   while ((libres > 0) && (cantidad > 0)) {
+      if (cantidad > libres) {
+         cantidad = libres;
+      }
+      for (indice = 0; indice < cantidad; indice++) {
+         Chip_UART_SendByte(uart, datos[indice]);
+      }
+      LoteDescartar(lote, cantidad);
+      libres -= cantidad;
+      cantidad = LoteTramo(lote, &datos);
+   }
+   return (FIFO_TX_LONGITUD - libres);
+}
+
+/* === Definiciones de funciones externas ================================== */
+
+int main(void) {
+   buzon_t * buzon = BUZON;
+   uint8_t indice;
+
+   /* El M4 escribe la firma antes de liberar el reset, la espera solo cubre
+      un arranque de la imagen sin el M4 */
+   while (buzon->firma != BUZON_FIRMA) {
+      __WFE();
+   }
+   uart = buzon->uart;
+   for (indice = 0; indice < sizeof(uarts) / sizeof(uarts[0]); indice++) {
+      if (uarts[indice].uart == uart) {
+         interrupcion = (IRQn_Type) uarts[indice].interrupcion;
+      }
+   }
+   NVIC_EnableIRQ(interrupcion);
+   NVIC_EnableIRQ((IRQn_Type) INTERRUPCION_M4);
+   Chip_UART_IntEnable(uart, UART_IER_RBRINT | UART_IER_RLSINT);
+
+   while (TRUE) {
+      __WFI();
+   }
+   return (0);
+}
+
+/* === Ciere de documentacion ============================================== */
+
+/** @} Final de la definición del modulo para doxygen */
@@ -0,0 +1,178 @@
+/* Copyright 2026, Gustavo Sosa - UTN FRT
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file bitacora.c
+ **
+ ** @brief Bitacora binaria con formateo diferido
+ **
+ ** Implementación de la cola de registros de la bitacora. Igual que en la
+ ** traza los productores escriben con las interrupciones suspendidas y el
+ ** unico consumidor es la tarea ociosa, que solo envia registros completos
+ ** para que no se mezclen con los mensajes de otras tareas.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2026.10.14 | gsosa       | Version inicial del archivo             |
+ **
+ ** @addtogroup ejemplos
+ ** @{
+ */
+
+/* === Inclusiones de cabeceras ============================================ */
+#include "bitacora.h"
+#include "cola.h"
+#include "serial.h"
+#include "chip.h"
+#include "os.h"
+
+/* === Definicion y Macros ================================================= */
+
+/** @brief Tamaño de la cola de registros de la bitacora
+ **
+ ** Debe ser una potencia de dos.
+ */
+#ifndef BITACORA_LONGITUD
+   #define BITACORA_LONGITUD  512
+#endif
+
+#if !COLA_TAMANIO_VALIDO(BITACORA_LONGITUD)
+   #error "BITACORA_LONGITUD debe ser una potencia de dos"
+#endif
+
+/** @brief Cantidad maxima de bytes de la bitacora que se encolan por vez
+ **
+ ** Limita el lugar que ocupa la bitacora en la cola de transmisión y el
+ ** tamaño de la copia en la pila de la tarea ociosa.
+ */
+#ifndef BITACORA_ENVIO_MAXIMO
+   #define BITACORA_ENVIO_MAXIMO 64
+#endif
+
+/* El registro mas largo tiene la cabecera y BITACORA_ARGUMENTOS_MAXIMO palabras */
+#if BITACORA_ENVIO_MAXIMO < 4 * (1 + BITACORA_ARGUMENTOS_MAXIMO)
+   #error "BITACORA_ENVIO_MAXIMO debe alcanzar para el registro mas largo"
+#endif
+
+/* === Declaraciones de tipos de datos internos ============================ */
+
+/* === Declaraciones de funciones internas ================================= */
+
+/* === Definiciones de variables internas ================================== */
+
+//! Memoria para los registros pendientes de envio
+uint8_t buffer_bitacora[BITACORA_LONGITUD];
+
+//! Cola con los registros pendientes de envio
+cola_t bitacora;
+
+//! Cantidad de mensajes descartados desde el ultimo registro encolado
+uint32_t descartados;
+
+/* === Definiciones de variables externas ================================== */
+
+/* === Definiciones de funciones internas ================================== */
+
+/* === Definiciones de funciones externas ================================== */
+
+void BitacoraIniciar(void) {
+   ColaIniciar(&bitacora, buffer_bitacora, sizeof(buffer_bitacora));
+   descartados = 0;
+}
+
+void BitacoraRegistrar(uint16_t identificador, const uint32_t * argumentos, uint8_t cantidad) {
+   registro_bitacora_t cabecera;
+   registro_bitacora_t aviso;
+   uint32_t longitud;
+   uint32_t desplazamiento = 0;
+
+   if (cantidad > BITACORA_ARGUMENTOS_MAXIMO) {
+      cantidad = BITACORA_ARGUMENTOS_MAXIMO;
+   }
+   cabecera.tipo = BITACORA_REGISTRO;
+   cabecera.cantidad = cantidad;
+   cabecera.identificador = identificador;
+   longitud = sizeof(cabecera) + cantidad * sizeof(uint32_t);
+
+   /* El mensaje y el aviso de perdidos se publican juntos o no se publican */
+   SuspendAllInterrupts();
+   if (descartados > 0) {
+      longitud += sizeof(aviso) + sizeof(descartados);
+   }
+   if (ColaLibre(&bitacora) >= longitud) {
+      if (descartados > 0) {
+         aviso.tipo = BITACORA_REGISTRO;
+         aviso.cantidad = 1;
+         aviso.identificador = BITACORA_PERDIDOS;
+         desplazamiento += ColaCopiar(&bitacora, desplazamiento, &aviso, sizeof(aviso));
+         desplazamiento += ColaCopiar(&bitacora, desplazamiento, &descartados, sizeof(descartados));
+      }
+      desplazamiento += ColaCopiar(&bitacora, desplazamiento, &cabecera, sizeof(cabecera));
+      desplazamiento += ColaCopiar(&bitacora, desplazamiento, argumentos, cantidad * sizeof(uint32_t));
+      ColaPublicar(&bitacora, desplazamiento);
+      descartados = 0;
+   } else {
+      descartados++;
+   }
+   ResumeAllInterrupts();
+}
+
+bool BitacoraEnviar(void) {
+   uint8_t registros[BITACORA_ENVIO_MAXIMO];
+   registro_bitacora_t cabecera;
+   uint32_t longitud;
+   uint32_t cantidad = 0;
+   bool completo = FALSE;
+   bool enviada = FALSE;
+
+   /* Los registros se publican completos, por lo que si la cabecera esta en
+      la cola tambien estan sus argumentos */
+   while (!completo && (ColaConsultar(&bitacora, cantidad, &cabecera, sizeof(cabecera))
+      == sizeof(cabecera))) {
+      longitud = sizeof(cabecera) + cabecera.cantidad * sizeof(uint32_t);
+      if (cantidad + longitud <= BITACORA_ENVIO_MAXIMO) {
+         cantidad += longitud;
+      } else {
+         completo = TRUE;
+      }
+   }
+   if (cantidad > 0) {
+      ColaConsultar(&bitacora, 0, registros, cantidad);
+      if (EnviarBloque(registros, cantidad)) {
+         ColaDescartar(&bitacora, cantidad);
+         enviada = TRUE;
+      }
+   }
+   return (enviada);
+}
+
+/* === Ciere de documentacion ============================================== */
+
+/** @} Final de la definición del modulo para doxygen */
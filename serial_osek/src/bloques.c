@@ -0,0 +1,116 @@
+/* Copyright 2026, Gustavo Sosa - UTN FRT
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file bloques.c
+ **
+ ** @brief Reserva de bloques de memoria de tamaño fijo
+ **
+ ** Implementación de la reserva de bloques con una cola circular de indices.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2026.10.14 | gsosa       | Version inicial del archivo             |
+ **
+ ** @addtogroup ejemplos
+ ** @{
+ */
+
+/* === Inclusiones de cabeceras ============================================ */
+#include <stddef.h>
+#include "bloques.h"
+#include "cola.h"
+
+/* === Definicion y Macros ================================================= */
+
+#if !COLA_TAMANIO_VALIDO(BLOQUES_CANTIDAD) || (BLOQUES_CANTIDAD > 256)
+   #error "BLOQUES_CANTIDAD debe ser una potencia de dos menor o igual a 256"
+#endif
+
+#if (BLOQUES_TAMANIO % 4) != 0
+   #error "BLOQUES_TAMANIO debe ser un multiplo de cuatro para alinear los bloques"
+#endif
+
+/* === Declaraciones de tipos de datos internos ============================ */
+
+/* === Declaraciones de funciones internas ================================= */
+
+/* === Definiciones de variables internas ================================== */
+
+//! Memoria de los bloques de la reserva
+uint32_t memoria_bloques[BLOQUES_CANTIDAD][BLOQUES_TAMANIO / 4];
+
+//! Memoria para los indices de los bloques libres
+uint8_t buffer_libres[BLOQUES_CANTIDAD];
+
+//! Cola con los indices de los bloques libres
+cola_t libres;
+
+/* === Definiciones de variables externas ================================== */
+
+/* === Definiciones de funciones internas ================================== */
+
+/* === Definiciones de funciones externas ================================== */
+
+void BloquesIniciar(void) {
+   uint32_t indice;
+   uint8_t bloque;
+
+   ColaIniciar(&libres, buffer_libres, sizeof(buffer_libres));
+   for (indice = 0; indice < BLOQUES_CANTIDAD; indice++) {
+      bloque = indice;
+      ColaEscribir(&libres, &bloque, 1);
+   }
+}
+
+void * BloquePedir(void) {
+   void * resultado = NULL;
+   uint8_t bloque;
+
+   if (ColaLeer(&libres, &bloque, 1)) {
+      resultado = memoria_bloques[bloque];
+   }
+   return (resultado);
+}
+
+void BloqueDevolver(void * bloque) {
+   uint8_t indice;
+
+   indice = ((uint32_t *) bloque - memoria_bloques[0]) / (BLOQUES_TAMANIO / 4);
+   ColaEscribir(&libres, &indice, 1);
+}
+
+uint32_t BloquesLibres(void) {
+   return (ColaOcupada(&libres));
+}
+
+/* === Ciere de documentacion ============================================== */
+
+/** @} Final de la definición del modulo para doxygen */
@@ -0,0 +1,206 @@
+/* Copyright 2026, Gustavo Sosa - UTN FRT
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file cola.c
+ **
+ ** @brief Cola circular de bytes sin bloqueos
+ **
+ ** Implementación de la cola circular de un productor y un consumidor. El orden
+ ** de las escrituras se garantiza con barreras de memoria antes de publicar
+ ** cada indice.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  5 | 2026.10.14 | gsosa       | Funciones de las rutinas en la RAM      |
+ ** |  4 | 2026.10.14 | gsosa       | Lectura de datos sin retirarlos         |
+ ** |  3 | 2026.10.14 | gsosa       | Copia de cadenas sin medirlas antes     |
+ ** |  2 | 2026.10.14 | gsosa       | Escritura de la cola en dos etapas      |
+ ** |  1 | 2026.10.14 | gsosa       | Version inicial del archivo             |
+ **
+ ** @addtogroup ejemplos
+ ** @{
+ */
+
+/* === Inclusiones de cabeceras ============================================ */
+#include <string.h>
+#include "cola.h"
+#include "chip.h"
+
+/* === Definicion y Macros ================================================= */
+
+/* === Declaraciones de tipos de datos internos ============================ */
+
+/* === Declaraciones de funciones internas ================================= */
+
+/* === Definiciones de variables internas ================================== */
+
+/* === Definiciones de variables externas ================================== */
+
+/* === Definiciones de funciones internas ================================== */
+
+/* === Definiciones de funciones externas ================================== */
+
+void ColaIniciar(cola_t * cola, uint8_t * bloque, uint32_t tamanio) {
+   cola->datos = bloque;
+   cola->mascara = tamanio - 1;
+   cola->entrada = 0;
+   cola->salida = 0;
+}
+
+uint32_t ColaOcupada(const cola_t * cola) {
+   return (cola->entrada - cola->salida);
+}
+
+uint32_t ColaLibre(const cola_t * cola) {
+   return (cola->mascara + 1 - (cola->entrada - cola->salida));
+}
+
+uint32_t ColaEscribir(cola_t * cola, const void * datos, uint32_t cantidad) {
+   cantidad = ColaCopiar(cola, 0, datos, cantidad);
+   ColaPublicar(cola, cantidad);
+   return (cantidad);
+}
+
+uint32_t ColaCopiar(cola_t * cola, uint32_t desplazamiento, const void * datos, uint32_t cantidad) {
+   uint32_t posicion;
+   uint32_t parcial;
+   uint32_t libres;
+
+   libres = ColaLibre(cola);
+   if (desplazamiento >= libres) {
+      cantidad = 0;
+   } else if (cantidad > libres - desplazamiento) {
+      cantidad = libres - desplazamiento;
+   }
+
+   /* La copia se divide en dos partes cuando llega al final del bloque */
+   posicion = (cola->entrada + desplazamiento) & cola->mascara;
+   parcial = cola->mascara + 1 - posicion;
+   if (parcial > cantidad) {
+      parcial = cantidad;
+   }
+   memcpy(&cola->datos[posicion], datos, parcial);
+   memcpy(cola->datos, (const uint8_t *) datos + parcial, cantidad - parcial);
+
+   return (cantidad);
+}
+
+uint32_t ColaCopiarTexto(cola_t * cola, uint32_t desplazamiento, const char * cadena) {
+   uint32_t posicion;
+   uint32_t libres;
+   uint32_t copiados = 0;
+
+   libres = ColaLibre(cola);
+   posicion = cola->entrada + desplazamiento;
+   while ((desplazamiento + copiados < libres) && (cadena[copiados] != '\0')) {
+      cola->datos[(posicion + copiados) & cola->mascara] = cadena[copiados];
+      copiados++;
+   }
+   return (copiados);
+}
+
+void ColaPublicar(cola_t * cola, uint32_t cantidad) {
+   /* Los datos deben estar en memoria antes de publicar el indice */
+   __DMB();
+   cola->entrada += cantidad;
+}
+
+uint32_t ColaBloque(const cola_t * cola, const uint8_t ** datos) {
+   uint32_t posicion;
+   uint32_t cantidad;
+
+   posicion = cola->salida & cola->mascara;
+   cantidad = cola->entrada - cola->salida;
+   if (cantidad > cola->mascara + 1 - posicion) {
+      cantidad = cola->mascara + 1 - posicion;
+   }
+
+   /* Los datos no se leen antes que el indice que los publica */
+   __DMB();
+   *datos = &cola->datos[posicion];
+
+   return (cantidad);
+}
+
+void ColaDescartar(cola_t * cola, uint32_t cantidad) {
+   /* Los datos deben estar leidos antes de liberar el espacio */
+   __DMB();
+   cola->salida += cantidad;
+}
+
+uint32_t ColaConsultar(const cola_t * cola, uint32_t desplazamiento, void * datos, uint32_t cantidad) {
+   uint32_t posicion;
+   uint32_t parcial;
+   uint32_t ocupados;
+
+   ocupados = ColaOcupada(cola);
+   if (desplazamiento >= ocupados) {
+      cantidad = 0;
+   } else if (cantidad > ocupados - desplazamiento) {
+      cantidad = ocupados - desplazamiento;
+   }
+
+   /* Los datos no se leen antes que el indice que los publica */
+   __DMB();
+   posicion = (cola->salida + desplazamiento) & cola->mascara;
+   parcial = cola->mascara + 1 - posicion;
+   if (parcial > cantidad) {
+      parcial = cantidad;
+   }
+   memcpy(datos, &cola->datos[posicion], parcial);
+   memcpy((uint8_t *) datos + parcial, cola->datos, cantidad - parcial);
+
+   return (cantidad);
+}
+
+uint32_t ColaLeer(cola_t * cola, void * datos, uint32_t cantidad) {
+   const uint8_t * bloque;
+   uint32_t parcial;
+   uint32_t leidos = 0;
+
+   while (leidos < cantidad) {
+      parcial = ColaBloque(cola, &bloque);
+      if (parcial == 0) {
+         break;
+      }
+      if (parcial > cantidad - leidos) {
+         parcial = cantidad - leidos;
+      }
+      memcpy((uint8_t *) datos + leidos, bloque, parcial);
+      ColaDescartar(cola, parcial);
+      leidos += parcial;
+   }
+   return (leidos);
+}
+
+/* === Ciere de documentacion ============================================== */
+
+/** @} Final de la definición del modulo para doxygen */
@@ -0,0 +1,120 @@
+/* Copyright 2026, Gustavo Sosa - UTN FRT
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file divisor.c
+ **
+ ** @brief Calculo de los divisores de velocidad de una uart
+ **
+ ** Implementación de la busqueda de los divisores con aritmetica entera de 64
+ ** bits, ya que solo se usa al configurar la velocidad.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2026.10.14 | gsosa       | Version inicial del archivo             |
+ **
+ ** @addtogroup ejemplos
+ ** @{
+ */
+
+/* === Inclusiones de cabeceras ============================================ */
+#include "divisor.h"
+#include "chip.h"
+
+/* === Definicion y Macros ================================================= */
+
+//! Valor maximo del campo MULVAL del registro FDR
+#define MULTIPLICADOR_MAXIMO  15
+
+//! Divisor entero minimo cuando se usa el divisor fraccional
+#define LATCH_MINIMO_FRACCION 3
+
+/* === Declaraciones de tipos de datos internos ============================ */
+
+/* === Declaraciones de funciones internas ================================= */
+
+/* === Definiciones de variables internas ================================== */
+
+/* === Definiciones de variables externas ================================== */
+
+/* === Definiciones de funciones internas ================================== */
+
+/* === Definiciones de funciones externas ================================== */
+
+bool DivisorCalcular(uint32_t reloj, uint32_t baudios, divisor_t * divisor) {
+   divisor_t prueba;
+   divisor_t mejor;
+   uint64_t latch;
+   uint64_t cociente;
+   uint32_t error;
+   uint32_t menor_error = UINT32_MAX;
+   bool valido = FALSE;
+
+   for (prueba.multiplicador = 1; (baudios > 0) && (prueba.multiplicador <= MULTIPLICADOR_MAXIMO);
+      prueba.multiplicador++) {
+      for (prueba.suma = 0; prueba.suma < prueba.multiplicador; prueba.suma++) {
+         /* Divisor entero redondeado para esta fracción */
+         cociente = (uint64_t) 16 * baudios * (prueba.multiplicador + prueba.suma);
+         latch = ((uint64_t) reloj * prueba.multiplicador + cociente / 2) / cociente;
+         if ((prueba.suma > 0) && (latch < LATCH_MINIMO_FRACCION)) {
+            latch = LATCH_MINIMO_FRACCION;
+         } else if (latch == 0) {
+            latch = 1;
+         }
+
+         if (latch <= UINT16_MAX) {
+            prueba.latch = latch;
+            error = DivisorBaudios(reloj, &prueba);
+            error = (error > baudios) ? error - baudios : baudios - error;
+            if (error < menor_error) {
+               menor_error = error;
+               mejor = prueba;
+            }
+         }
+      }
+   }
+
+   if ((uint64_t) menor_error * 1000 <= (uint64_t) baudios * DIVISOR_TOLERANCIA) {
+      *divisor = mejor;
+      valido = TRUE;
+   }
+   return (valido);
+}
+
+uint32_t DivisorBaudios(uint32_t reloj, const divisor_t * divisor) {
+   uint64_t cociente;
+
+   cociente = (uint64_t) 16 * divisor->latch * (divisor->multiplicador + divisor->suma);
+   return (((uint64_t) reloj * divisor->multiplicador + cociente / 2) / cociente);
+}
+
+/* === Ciere de documentacion ============================================== */
+
+/** @} Final de la definición del modulo para doxygen */
@@ -0,0 +1,273 @@
+/* Copyright 2026, Gustavo Sosa - UTN FRT
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file formato.c
+ **
+ ** @brief Formateo de mensajes en la cola de transmisión
+ **
+ ** Implementación del formateo de mensajes. Los textos fijos y las cadenas se
+ ** copian directamente en la cola de transmisión y los valores numericos se
+ ** convierten en un buffer de @ref FORMATO_ANCHO_MAXIMO caracteres en la pila.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  2 | 2026.10.14 | gsosa       | Limites del campo en toda conversión    |
+ ** |  1 | 2026.10.14 | gsosa       | Version inicial del archivo             |
+ **
+ ** @addtogroup ejemplos
+ ** @{
+ */
+
+/* === Inclusiones de cabeceras ============================================ */
+#include <stdarg.h>
+#include "formato.h"
+#include "serial.h"
+#include "chip.h"
+
+/* === Definicion y Macros ================================================= */
+
+/* === Declaraciones de tipos de datos internos ============================ */
+
+/* === Declaraciones de funciones internas ================================= */
+
+/** @brief Interpreta una especificación de una cadena de formato
+ **
+ ** @param[in] formato Puntero al caracter siguiente al signo de porcentaje.
+ ** @param[out] campo Campo con el tipo, ancho, decimales y relleno.
+ ** @param[out] conversion Caracter que indica la conversión.
+ ** @return Puntero al caracter siguiente a la especificación.
+ */
+const char * LeerEspecificacion(const char * formato, campo_t * campo, char * conversion);
+
+/** @brief Convierte un valor numerico en texto
+ **
+ ** El ancho y los decimales del campo se recortan a @ref FORMATO_ANCHO_MAXIMO
+ ** y @ref FORMATO_DECIMALES_MAXIMO, tanto en las cadenas de formato como en
+ ** las plantillas.
+ **
+ ** @param[out] texto Buffer de @ref FORMATO_ANCHO_MAXIMO caracteres.
+ ** @param[in] valor Valor a convertir, se interpreta segun el tipo del campo.
+ ** @param[in] campo Campo con el tipo, ancho, decimales y relleno.
+ ** @return Cantidad de caracteres del texto.
+ */
+uint8_t ConvertirNumero(char * texto, int32_t valor, const campo_t * campo);
+
+/* === Definiciones de variables internas ================================== */
+
+/* === Definiciones de variables externas ================================== */
+
+/* === Definiciones de funciones internas ================================== */
+
+const char * LeerEspecificacion(const char * formato, campo_t * campo, char * conversion) {
+   campo->ancho = 0;
+   campo->decimales = 0;
+   campo->relleno = ' ';
+
+   if (*formato == '0') {
+      campo->relleno = '0';
+      formato++;
+   }
+   while ((*formato >= '0') && (*formato <= '9')) {
+      campo->ancho = campo->ancho * 10 + (*formato - '0');
+      formato++;
+   }
+   if (*formato == '.') {
+      formato++;
+      while ((*formato >= '0') && (*formato <= '9')) {
+         campo->decimales = campo->decimales * 10 + (*formato - '0');
+         formato++;
+      }
+   }
+   *conversion = *formato;
+   switch (*conversion) {
+   case 'd':
+   case 'i':
+      campo->tipo = FORMATO_ENTERO;
+      break;
+   case 'u':
+      campo->tipo = FORMATO_NATURAL;
+      break;
+   case 'x':
+      campo->tipo = FORMATO_HEXA;
+      break;
+   case 'X':
+      campo->tipo = FORMATO_HEXA_MAYUSCULAS;
+      break;
+   case 'q':
+      campo->tipo = FORMATO_FIJO;
+      break;
+   default:
+      campo->tipo = FORMATO_TEXTO;
+      break;
+   }
+   if (*formato != '\0') {
+      formato++;
+   }
+   return (formato);
+}
+
+uint8_t ConvertirNumero(char * texto, int32_t valor, const campo_t * campo) {
+   static const char minusculas[] = "0123456789abcdef";
+   static const char mayusculas[] = "0123456789ABCDEF";
+   const char * cifras = minusculas;
+   char invertido[12];
+   uint32_t magnitud = (uint32_t) valor;
+   uint32_t base = 10;
+   uint8_t ancho = campo->ancho;
+   uint8_t decimales = campo->decimales;
+   uint8_t minimo = 1;
+   uint8_t cantidad = 0;
+   uint8_t longitud = 0;
+   bool negativo = FALSE;
+
+   /* Los limites protegen al texto y a las cifras invertidas en la pila */
+   if (ancho > FORMATO_ANCHO_MAXIMO) {
+      ancho = FORMATO_ANCHO_MAXIMO;
+   }
+   if (decimales > FORMATO_DECIMALES_MAXIMO) {
+      decimales = FORMATO_DECIMALES_MAXIMO;
+   }
+   if (((campo->tipo == FORMATO_ENTERO) || (campo->tipo == FORMATO_FIJO)) && (valor < 0)) {
+      negativo = TRUE;
+      magnitud = 0U - magnitud;
+   }
+   if (campo->tipo == FORMATO_HEXA_MAYUSCULAS) {
+      cifras = mayusculas;
+   }
+   if ((campo->tipo == FORMATO_HEXA) || (campo->tipo == FORMATO_HEXA_MAYUSCULAS)) {
+      base = 16;
+   }
+   if ((campo->tipo == FORMATO_FIJO) && (decimales > 0)) {
+      /* Las cifras decimales, la coma y al menos una cifra entera */
+      minimo = decimales + 2;
+   }
+
+   /* Las cifras se obtienen desde la menos significativa */
+   do {
+      invertido[cantidad++] = cifras[magnitud % base];
+      magnitud /= base;
+      if ((campo->tipo == FORMATO_FIJO) && (cantidad == decimales)) {
+         invertido[cantidad++] = '.';
+      }
+   } while ((magnitud > 0) || (cantidad < minimo));
+
+   if ((campo->relleno != '0') && (ancho > cantidad + negativo)) {
+      while (longitud < ancho - cantidad - negativo) {
+         texto[longitud++] = ' ';
+      }
+   }
+   if (negativo) {
+      texto[longitud++] = '-';
+   }
+   while (longitud < ancho - cantidad) {
+      texto[longitud++] = '0';
+   }
+   while (cantidad > 0) {
+      texto[longitud++] = invertido[--cantidad];
+   }
+   return (longitud);
+}
+
+/* === Definiciones de funciones externas ================================== */
+
+bool EnviarFormato(const char * formato, ...) {
+   va_list argumentos;
+   campo_t campo;
+   char texto[FORMATO_ANCHO_MAXIMO];
+   const char * inicio;
+   char conversion;
+   bool completo = FALSE;
+
+   if (ReservarEspacio(0)) {
+      completo = TRUE;
+      va_start(argumentos, formato);
+
+      while (completo && (*formato != '\0')) {
+         /* El texto fijo se copia sin cambios hasta la siguiente especificación */
+         inicio = formato;
+         while ((*formato != '\0') && (*formato != '%')) {
+            formato++;
+         }
+         completo = EscribirReserva(inicio, formato - inicio);
+
+         if (completo && (*formato == '%')) {
+            formato = LeerEspecificacion(formato + 1, &campo, &conversion);
+            if (campo.tipo != FORMATO_TEXTO) {
+               completo = EscribirReserva(texto,
+                  ConvertirNumero(texto, va_arg(argumentos, int32_t), &campo));
+            } else if (conversion == 's') {
+               completo = EscribirTexto(va_arg(argumentos, const char *));
+            } else if (conversion == 'c') {
+               texto[0] = (char) va_arg(argumentos, int);
+               completo = EscribirReserva(texto, 1);
+            } else if (conversion != '\0') {
+               completo = EscribirReserva(&conversion, 1);
+            }
+         }
+      }
+      va_end(argumentos);
+
+      if (completo) {
+         ConfirmarReserva();
+      } else {
+         CancelarReserva();
+      }
+   }
+   return (completo);
+}
+
+bool EnviarPlantilla(const campo_t * campos, uint8_t cantidad, const int32_t * valores) {
+   char texto[FORMATO_ANCHO_MAXIMO];
+   uint8_t indice;
+   bool completo = FALSE;
+
+   if (ReservarEspacio(0)) {
+      completo = TRUE;
+      for (indice = 0; completo && (indice < cantidad); indice++) {
+         completo = EscribirReserva(campos[indice].texto, campos[indice].longitud);
+         if (completo && (campos[indice].tipo != FORMATO_TEXTO)) {
+            completo = EscribirReserva(texto,
+               ConvertirNumero(texto, valores[indice], &campos[indice]));
+         }
+      }
+
+      if (completo) {
+         ConfirmarReserva();
+      } else {
+         CancelarReserva();
+      }
+   }
+   return (completo);
+}
+
+/* === Ciere de documentacion ============================================== */
+
+/** @} Final de la definición del modulo para doxygen */
@@ -0,0 +1,151 @@
+/* Copyright 2026, Gustavo Sosa - UTN FRT
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file lote.c
+ **
+ ** @brief Intercalado de los avisos urgentes con los mensajes normales
+ **
+ ** Implementación de la politica de lotes de avisos urgentes. Se compila en
+ ** la imagen del M4 y en la del coprocesador, por lo que solo usa las colas.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2026.10.14 | gsosa       | Version inicial del archivo             |
+ **
+ ** @addtogroup ejemplos
+ ** @{
+ */
+
+/* === Inclusiones de cabeceras ============================================ */
+#include <stddef.h>
+#include "lote.h"
+#include "chip.h"
+
+/* === Definicion y Macros ================================================= */
+
+//! Proximo limite entre mensajes normales pendiente
+#define PROXIMO_LIMITE(lote)  ((lote)->limites[(lote)->salida & (lote)->mascara])
+
+//! Indica si hay limites registrados que la salida todavia no paso
+#define LIMITE_PENDIENTE(lote) \
+   (((lote)->limites != NULL) && ((lote)->salida != (lote)->entrada))
+
+/* === Declaraciones de tipos de datos internos ============================ */
+
+/* === Declaraciones de funciones internas ================================= */
+
+/* === Definiciones de variables internas ================================== */
+
+/* === Definiciones de variables externas ================================== */
+
+/* === Definiciones de funciones internas ================================== */
+
+/* === Definiciones de funciones externas ================================== */
+
+void LoteIniciar(lote_t * lote, cola_t * normal, cola_t * urgente,
+   uint32_t * limites, uint32_t cantidad) {
+   lote->normal = normal;
+   lote->urgente = urgente;
+   lote->limites = (cantidad > 0) ? limites : NULL;
+   lote->mascara = cantidad - 1;
+   lote->entrada = 0;
+   lote->salida = 0;
+   lote->fin = urgente->salida;
+   lote->cediendo = FALSE;
+}
+
+void LoteRegistrar(lote_t * lote, uint32_t posicion) {
+   if ((lote->limites != NULL) && (lote->entrada - lote->salida <= lote->mascara)) {
+      lote->limites[lote->entrada & lote->mascara] = posicion;
+      /* El limite debe estar en memoria antes de publicar el indice */
+      __DMB();
+      lote->entrada++;
+   }
+}
+
+bool LoteLimite(const lote_t * lote) {
+   bool limite = TRUE;
+
+   if ((lote->limites != NULL) && (ColaOcupada(lote->normal) > 0)) {
+      limite = LIMITE_PENDIENTE(lote) && (PROXIMO_LIMITE(lote) == lote->normal->salida);
+   }
+   return (limite);
+}
+
+uint32_t LoteTramo(lote_t * lote, const uint8_t ** datos) {
+   uint32_t cantidad;
+   uint32_t distancia;
+
+   /* Un lote de avisos urgentes solo empieza en un limite de la cola normal
+      y toma los avisos encolados en ese momento, para no postergar a los
+      datos normales por mas de un lote */
+   if (!LOTE_URGENTE(lote) && (ColaOcupada(lote->urgente) > 0)
+      && (!lote->cediendo) && LoteLimite(lote)) {
+      lote->fin = lote->urgente->entrada;
+   }
+
+   if (LOTE_URGENTE(lote)) {
+      cantidad = ColaBloque(lote->urgente, datos);
+      if (cantidad > lote->fin - lote->urgente->salida) {
+         cantidad = lote->fin - lote->urgente->salida;
+      }
+   } else {
+      /* Se deja atras el limite alcanzado por la salida de la cola normal */
+      if (LIMITE_PENDIENTE(lote) && (PROXIMO_LIMITE(lote) == lote->normal->salida)) {
+         lote->salida++;
+      }
+      cantidad = ColaBloque(lote->normal, datos);
+      if (LIMITE_PENDIENTE(lote)) {
+         /* Tampoco se pasa el fin del mensaje para atender avisos urgentes */
+         distancia = PROXIMO_LIMITE(lote) - lote->normal->salida;
+         if (cantidad > distancia) {
+            cantidad = distancia;
+         }
+      }
+   }
+   return (cantidad);
+}
+
+void LoteDescartar(lote_t * lote, uint32_t cantidad) {
+   if (LOTE_URGENTE(lote)) {
+      ColaDescartar(lote->urgente, cantidad);
+      lote->cediendo = !LOTE_URGENTE(lote) && (ColaOcupada(lote->normal) > 0);
+   } else {
+      ColaDescartar(lote->normal, cantidad);
+      if (lote->cediendo && LoteLimite(lote)) {
+         lote->cediendo = FALSE;
+      }
+   }
+}
+
+/* === Ciere de documentacion ============================================== */
+
+/** @} Final de la definición del modulo para doxygen */
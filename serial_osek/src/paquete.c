@@ -0,0 +1,222 @@
+/* Copyright 2026, Gustavo Sosa - UTN FRT
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file paquete.c
+ **
+ ** @brief Paquetes binarios con codificación COBS y CRC
+ **
+ ** Implementación de la codificación COBS sobre la reserva de la cola de
+ ** transmisión. El byte de codigo de cada bloque se escribe al comenzar el
+ ** bloque y se corrige con @ref CorregirReserva cuando se conoce su longitud,
+ ** por lo que los datos se copian en la cola por tramos sin bytes nulos.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  2 | 2026.10.14 | gsosa       | Comparacion sin signo al decodificar    |
+ ** |  1 | 2026.10.14 | gsosa       | Version inicial del archivo             |
+ **
+ ** @addtogroup ejemplos
+ ** @{
+ */
+
+/* === Inclusiones de cabeceras ============================================ */
+#include <string.h>
+#include "paquete.h"
+#include "chip.h"
+#include "os.h"
+
+/* === Definicion y Macros ================================================= */
+
+//! Longitud maxima de un bloque de COBS contando su byte de codigo
+#define COBS_BLOQUE           255
+
+/* === Declaraciones de tipos de datos internos ============================ */
+
+//! Estado de la codificación de un paquete en la reserva
+typedef struct {
+   uint32_t codigo;              /** < Posición en la reserva del codigo del bloque */
+   uint8_t longitud;             /** < Longitud del bloque contando el codigo */
+} cobs_t;
+
+/* === Declaraciones de funciones internas ================================= */
+
+/** @brief Comienza un bloque de COBS en la reserva
+ **
+ ** @param[out] cobs Estado de la codificación.
+ */
+void IniciarBloque(cobs_t * cobs);
+
+/** @brief Escribe el codigo del bloque en curso y comienza uno nuevo
+ **
+ ** @param[in,out] cobs Estado de la codificación.
+ */
+void CerrarBloque(cobs_t * cobs);
+
+/** @brief Codifica datos en la reserva
+ **
+ ** @param[in,out] cobs Estado de la codificación.
+ ** @param[in] datos Puntero a los datos que se codifican.
+ ** @param[in] cantidad Cantidad de bytes.
+ */
+void Codificar(cobs_t * cobs, const uint8_t * datos, uint32_t cantidad);
+
+/* === Definiciones de variables internas ================================== */
+
+/* === Definiciones de variables externas ================================== */
+
+/* === Definiciones de funciones internas ================================== */
+
+void IniciarBloque(cobs_t * cobs) {
+   cobs->codigo = EscritosReserva();
+   cobs->longitud = 1;
+   EscribirReserva("\xFF", 1);
+}
+
+void CerrarBloque(cobs_t * cobs) {
+   CorregirReserva(cobs->codigo, &cobs->longitud, 1);
+   IniciarBloque(cobs);
+}
+
+void Codificar(cobs_t * cobs, const uint8_t * datos, uint32_t cantidad) {
+   const uint8_t * nulo;
+   uint32_t tramo;
+
+   while (cantidad > 0) {
+      /* Los bytes hasta el proximo nulo se copian juntos en el bloque */
+      tramo = COBS_BLOQUE - cobs->longitud;
+      if (tramo > cantidad) {
+         tramo = cantidad;
+      }
+      nulo = memchr(datos, 0, tramo);
+      if (nulo != NULL) {
+         tramo = nulo - datos;
+      }
+      EscribirReserva(datos, tramo);
+      cobs->longitud += tramo;
+      datos += tramo;
+      cantidad -= tramo;
+
+      if (nulo != NULL) {
+         /* El nulo queda implicito en el codigo del bloque */
+         CerrarBloque(cobs);
+         datos++;
+         cantidad--;
+      } else if (cobs->longitud == COBS_BLOQUE) {
+         CerrarBloque(cobs);
+      }
+   }
+}
+
+/* === Definiciones de funciones externas ================================== */
+
+void PaquetesIniciar(void) {
+   Chip_CRC_Init();
+}
+
+bool EnviarPaqueteFragmentos(puerto_serial_t puerto, const fragmento_t * fragmentos,
+   uint8_t cantidad) {
+   cobs_t cobs;
+   uint32_t total = 0;
+   uint16_t crc;
+   uint8_t final[PAQUETE_CRC];
+   uint8_t indice;
+   bool encolado = FALSE;
+
+   for (indice = 0; indice < cantidad; indice++) {
+      total += fragmentos[indice].cantidad;
+   }
+
+   /* El motor de CRC se usa con la reserva tomada, que lo protege de las
+      otras tareas que envian o reciben paquetes */
+   if (ReservarPuerto(puerto, PAQUETE_MAXIMO(total))) {
+      Chip_CRC_UseCCITT();
+      IniciarBloque(&cobs);
+      for (indice = 0; indice < cantidad; indice++) {
+         Chip_CRC_CRC8(fragmentos[indice].datos, fragmentos[indice].cantidad);
+         Codificar(&cobs, fragmentos[indice].datos, fragmentos[indice].cantidad);
+      }
+      crc = Chip_CRC_Sum();
+      final[0] = crc >> 8;
+      final[1] = crc & 0xFF;
+      Codificar(&cobs, final, sizeof(final));
+
+      CorregirReserva(cobs.codigo, &cobs.longitud, 1);
+      final[0] = PAQUETE_DELIMITADOR;
+      EscribirReserva(final, 1);
+      ConfirmarReserva();
+      encolado = TRUE;
+   }
+   return (encolado);
+}
+
+bool EnviarPaquete(puerto_serial_t puerto, const void * datos, uint32_t cantidad) {
+   fragmento_t fragmento = { datos, cantidad };
+
+   return (EnviarPaqueteFragmentos(puerto, &fragmento, 1));
+}
+
+uint32_t PaqueteDecodificar(uint8_t * trama, uint32_t cantidad) {
+   uint32_t lectura = 0;
+   uint32_t escritura = 0;
+   uint8_t codigo;
+   bool valido = (cantidad > 0);
+
+   while (valido && (lectura < cantidad)) {
+      codigo = trama[lectura++];
+      /* La resta sin signo no desborda porque la lectura nunca pasa la trama */
+      valido = (codigo != 0) && (lectura <= cantidad)
+         && ((uint32_t) (codigo - 1) <= cantidad - lectura);
+      if (valido) {
+         memmove(&trama[escritura], &trama[lectura], codigo - 1);
+         escritura += codigo - 1;
+         lectura += codigo - 1;
+         /* Todos los bloques salvo el ultimo y los completos terminan en nulo */
+         if ((codigo != COBS_BLOQUE) && (lectura < cantidad)) {
+            trama[escritura++] = 0;
+         }
+      }
+   }
+
+   valido = valido && (escritura >= PAQUETE_CRC);
+   if (valido) {
+      escritura -= PAQUETE_CRC;
+      GetResource(RecursoSerial);
+      Chip_CRC_UseCCITT();
+      valido = (Chip_CRC_CRC8(trama, escritura)
+         == (((uint32_t) trama[escritura] << 8) | trama[escritura + 1]));
+      ReleaseResource(RecursoSerial);
+   }
+   return (valido ? escritura : 0);
+}
+
+/* === Ciere de documentacion ============================================== */
+
+/** @} Final de la definición del modulo para doxygen */
@@ -0,0 +1,94 @@
+/* Copyright 2026, Gustavo Sosa - UTN FRT
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file pila.c
+ **
+ ** @brief Medición del uso de las pilas de las tareas
+ **
+ ** Implementación de la medición con la tabla TasksConst que genera FreeOSEK a
+ ** partir del archivo OIL, que tiene la dirección y el tamaño de cada pila.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2026.10.14 | gsosa       | Version inicial del archivo             |
+ **
+ ** @addtogroup ejemplos
+ ** @{
+ */
+
+/* === Inclusiones de cabeceras ============================================ */
+#include "pila.h"
+#include "Os_Internal.h"
+
+/* === Definicion y Macros ================================================= */
+
+/* === Declaraciones de tipos de datos internos ============================ */
+
+/* === Declaraciones de funciones internas ================================= */
+
+/* === Definiciones de variables internas ================================== */
+
+/* === Definiciones de variables externas ================================== */
+
+/* === Definiciones de funciones internas ================================== */
+
+/* === Definiciones de funciones externas ================================== */
+
+void PilaPintar(void) {
+   TaskType tarea;
+   uint8_t * pila;
+   uint32_t indice;
+
+   for (tarea = 0; tarea < TASKS_COUNT; tarea++) {
+      pila = (uint8_t *) TasksConst[tarea].StackPtr;
+      for (indice = 0; indice < TasksConst[tarea].StackSize; indice++) {
+         pila[indice] = PILA_PATRON;
+      }
+   }
+}
+
+uint32_t PilaTamanio(TaskType tarea) {
+   return (TasksConst[tarea].StackSize);
+}
+
+uint32_t PilaUsada(TaskType tarea) {
+   const uint8_t * pila = (const uint8_t *) TasksConst[tarea].StackPtr;
+   uint32_t libres = 0;
+
+   while ((libres < TasksConst[tarea].StackSize) && (pila[libres] == PILA_PATRON)) {
+      libres++;
+   }
+   return (TasksConst[tarea].StackSize - libres);
+}
+
+/* === Ciere de documentacion ============================================== */
+
+/** @} Final de la definición del modulo para doxygen */
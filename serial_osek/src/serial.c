@@ -1,304 +1,2604 @@
-/* Copyright 2018, Gustavo Sosa - UTN FRT
- * Copyright 2017, Esteban Volentini - Facet UNT, Fi UNER
- * Copyright 2014, Mariano Cerdeiro
- * Copyright 2014, Pablo Ridolfi
- * Copyright 2014, Juan Cecconi
- * Copyright 2014, Gustavo Muro
- *
- * All rights reserved.
- *
- * Redistribution and use in source and binary forms, with or without
- * modification, are permitted provided that the following conditions are met:
- *
- * 1. Redistributions of source code must retain the above copyright notice,
- *    this list of conditions and the following disclaimer.
- *
- * 2. Redistributions in binary form must reproduce the above copyright notice,
- *    this list of conditions and the following disclaimer in the documentation
- *    and/or other materials provided with the distribution.
- *
- * 3. Neither the name of the copyright holder nor the names of its
- *    contributors may be used to endorse or promote products derived from this
- *    software without specific prior written permission.
- *
- * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
- * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
- * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
- * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
- * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
- * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
- * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
- * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
- * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
- * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
- * POSSIBILITY OF SUCH DAMAGE.
- */
-
-/** @file serial.c
- **
- ** @brief Transmisión serial con interrupciones y FreeOSEK
- **
- ** Ejemplo de una transmisión serial utilizando interupciones y FreeOSEK. En 
- ** el mismo una tarea escanea el teclado y cuando se pulsa la tecla 1 se 
- ** activa una tarea que envia la cadena 'Hola' y una vez completa la transición
- ** de la misma se envia la cadena 'Mundo'.
- ** 
- ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
- ** |----|------------|-------------|-----------------------------------------|
- ** |  3 | 2018.09.19 | gsosa       | Adaptación código final                 |
- ** |  2 | 2017.10.21 | evolentini  | Correción en el formato del archivo     |
- ** |  1 | 2017.09.16 | evolentini  | Version inicial del archivo             |
- ** 
- ** @defgroup ejemplos Proyectos de ejemplo
- ** @brief Proyectos de ejemplo de la Especialización en Sistemas Embebidos
- ** @{ 
- */
-
-/* === Inclusiones de cabeceras ============================================ */
-#include <stdint.h>
-#include <string.h>
-#include "serial.h"
-#include "led.h"
-#include "switch.h"
-#include "uart.h"
-#include "os.h"
-
-/* === Definicion y Macros ================================================= */
-
-/* === Declaraciones de tipos de datos internos ============================ */
-
-/** @brief Estructura de datos para transmisión
- ** 
- ** Estructura que contiene los datos necesarios para que la interrupción 
- ** pueda continuar el envio de datos usando la función @ref EnviarCaracter
- ** de la transmisisión iniciada por la función @ref EnviarTexto.
- */
-typedef struct {
-   const char * datos;   /** < Puntero al bloque de datos a enviar */
-   uint8_t cantidad;     /** < Cantidad de datos a enviar */
-   uint8_t enviados;     /** < Cantidad de datos enviados */
-} cola_t;
-
-/* === Declaraciones de funciones internas ================================= */
-
-/** @brief Envio de una cadena por puerto serial
- **
- ** Esta función comienza el envio de una cadena serial por el puerto de la 
- ** uart conectada a la interface de depuracion USB. La función es no blocante
- ** y el resto de la cadena se envia mediante interupciones utilizando la
- ** función @ref EnviarCaracter en la rutina de servicio.
- ** 
- ** @param[in] cadena Puntero con la cadena de caracteres a enviar.
- ** @return Indica si quedan caracteres para enviar por interrupciones.
- */
-bool EnviarTexto(const char * cadena);
-
-/** @brief Envio de un caracter en una interrupcion.
- **
- ** Esta función envia un caracter por el puerto serie durante una rutina de
- ** servicio de interrupcion. La misma continua la transmisión inciada por la
- ** función @ref EnviarTexto.
- ** 
- ** @return Indica si se completó el envio de la cadena.
- */
-bool EnviarCaracter(void);
-
-/* === Definiciones de variables internas ================================== */
-
-//! Información para el envio de datos por la uart
-cola_t cola;
-
-//! Tarea que espera el evento de transmisión completa
-TaskType tarea;
-
-/* === Definiciones de variables externas ================================== */
-
-/* === Definiciones de funciones internas ================================== */
-
-bool EnviarTexto(const char * cadena) {
-   bool pendiente = FALSE;
-
-   cola.datos = cadena;
-   cola.cantidad = strlen(cadena);
-   cola.enviados = 0;
-
-   if (cola.cantidad) {
-      Chip_UART_SendByte(USB_UART, cola.datos[cola.enviados]);
-      cola.enviados++;
-
-      if (cola.enviados < cola.cantidad) {
-         Chip_UART_IntEnable(USB_UART, UART_IER_THREINT);
-         pendiente = TRUE;
-      }
-   }
-   return (pendiente);
-}
-
-bool EnviarCaracter(void) {
-   uint8_t eventos;
-   bool completo = FALSE;
-
-   eventos = Chip_UART_ReadLineStatus(USB_UART);
-
-   if (eventos & UART_LSR_THRE) {
-      Chip_UART_SendByte(USB_UART, cola.datos[cola.enviados]);
-      cola.enviados++;
-
-      if (cola.enviados == cola.cantidad) {
-         Chip_UART_IntDisable(USB_UART, UART_IER_THREINT);
-         completo = TRUE;
-      }
-   }
-   return (completo);
-}
-
-/* === Definiciones de funciones externas ================================== */
-
-/** @brief Tarea de configuración
- **
- ** Esta tarea arranca automaticamente en el modo de aplicacion Normal.
- */
-TASK(Configuracion) {
-
-   /* Inicializaciones y configuraciones de dispositivos */
-   Init_Leds();
-   Init_Switches();
-   Init_Uart_Ftdi();
-
-   /* Arranque de la alarma para la activación periorica de la tarea Baliza */
-   SetRelAlarm(RevisarTeclado, 250, 100);
-
-   /* Terminación de la tarea */
-   TerminateTask();
-}
-
-/** @brief Tarea que escanea el teclado
- **
- ** Esta tarea se activa cada vez que expira la alarma RevisarTeclado, lee
- ** el estado actual de la teclas y lo compara con el de la ultima activacion
- ** para detectar los cambios en las teclas y generar eventos al detectar la
- ** pulsación de una tecla.
- */
-TASK(Teclado) {
-   static uint8_t anterior = 0;
-   uint8_t tecla;
-
-   tecla = Read_Switches();
-   if (tecla != anterior) {
-      switch(tecla) {
-      case TEC1:
-         ActivateTask(Enviar);
-         break;
-      case TEC2:
-         break;
-      case TEC3:
-         break;
-      case TEC4:
-         SetEvent(Enviar, Completo);
-         break;
-      }
-      anterior = tecla;
-   }
-   Led_Toggle(GREEN_LED);
-
-   /* Terminación de la tarea */
-   TerminateTask();
-}
-
-/** @brief Tarea que envia la cadena
- **
- ** Esta tarea se activa cada vez que presiona la tecla uno y transmite la
- ** cadena Hola y despues la cadena Mundo
- */
-TASK(Enviar) {
-   
-   Led_On(YELLOW_LED);
-   /* Espera que se transmita la primera cadena */
-   if (EnviarTexto("Estan ahí mis vidaas? ")) {
-      GetTaskID(&tarea);
-      ClearEvent(Completo);
-      WaitEvent(Completo);
-   }
-   /* Espera que se transmita la segunda cadena */
-   if (EnviarTexto("Me oyen? Me escuchan? Me sienten?\r\n")) {
-      GetTaskID(&tarea);
-      ClearEvent(Completo);
-      WaitEvent(Completo);
-   }
-   Led_Off(YELLOW_LED);
-
-   /* Terminación de la tarea */
-   TerminateTask();
-}
-
-/** @brief Rutina de servicio interrupcion serial
- **
- ** Esta rutina se activa cada vez que se vacia el buffer de transmisión de
- ** la uart y se encarga de enviar el siguiente caracter y si se completó la
- ** transmisión entonces notifica a la tarea con un evento.
- */
-ISR(EventoSerial) {
-   if (EnviarCaracter()) {      
-      SetEvent(tarea, Completo);
-   };
-}
-
-/** @brief Tarea que aumenta contador de segundos
- **
- ** Esta tarea se activa cada vez que expira la alarma IncrementarSegundo
- **
- */
-TASK(Aumento) {
-
-   Led_On(RGB_B_LED);
-   /* Terminación de la tarea */
-   TerminateTask();
-}
-
-/** @brief Función para interceptar errores
- **
- ** Esta función es llamada desde el sistema operativo si una función de 
- ** interface (API) devuelve un error. Esta definida para facilitar la
- ** depuración y detiene el sistema operativo llamando a la función
- ** ShutdownOs.
- **
- ** Los valores:
- **    OSErrorGetServiceId
- **    OSErrorGetParam1
- **    OSErrorGetParam2
- **    OSErrorGetParam3
- **    OSErrorGetRet
- ** brindan acceso a la interface que produjo el error, los parametros de 
- ** entrada y el valor de retorno de la misma.
- **
- ** Para mas detalles consultar la especificación de OSEK:
- ** http://portal.osek-vdx.org/files/pdf/specs/os223.pdf
- */
-void ErrorHook(void) {
-   Led_On(RED_LED);
-   ShutdownOS(0);
-}
-
-/** @brief Función principal del programa
- **
- ** @returns 0 La función nunca debería terminar
- **
- ** \remark En un sistema embebido la función main() nunca debe terminar.
- **         El valor de retorno 0 es para evitar un error en el compilador.
- */
-int main(void) {
-
-   /* Inicio del sistema operatvio en el modo de aplicación Normal */
-   StartOS(Normal);
-
-   /* StartOs solo retorna si se detiene el sistema operativo */
-   while(1);
-
-   /* El valor de retorno es solo para evitar errores en el compilador*/
-   return 0;
-}
-
-/* === Ciere de documentacion ============================================== */
-
-/** @} Final de la definición del modulo para doxygen */
-
+/* Copyright 2018, Gustavo Sosa - UTN FRT
+ * Copyright 2017, Esteban Volentini - Facet UNT, Fi UNER
+ * Copyright 2014, Mariano Cerdeiro
+ * Copyright 2014, Pablo Ridolfi
+ * Copyright 2014, Juan Cecconi
+ * Copyright 2014, Gustavo Muro
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file serial.c
+ **
+ ** @brief Transmisión serial con interrupciones y FreeOSEK
+ **
+ ** Ejemplo de una transmisión serial utilizando interupciones y FreeOSEK. En 
+ ** el mismo una tarea escanea el teclado y cuando se pulsa la tecla 1 se 
+ ** activa una tarea que envia la cadena 'Hola' y una vez completa la transición
+ ** de la misma se envia la cadena 'Mundo'.
+ ** 
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** | 34 | 2026.10.14 | gsosa       | Lotes urgentes compartidos con el M0    |
+ ** | 33 | 2026.10.14 | gsosa       | Un solo reintento pendiente del envio   |
+ ** | 32 | 2026.10.14 | gsosa       | Consola atendida por el Cortex-M0       |
+ ** | 31 | 2026.10.14 | gsosa       | Estadisticas de los puertos             |
+ ** | 30 | 2026.10.14 | gsosa       | Nivel de disparo adaptativo             |
+ ** | 29 | 2026.10.14 | gsosa       | Rutinas de servicio en la RAM local     |
+ ** | 28 | 2026.10.14 | gsosa       | Configuración de puertos desde el OIL   |
+ ** | 27 | 2026.10.14 | gsosa       | Bitacora binaria con formateo diferido  |
+ ** | 26 | 2026.10.14 | gsosa       | Agrupamiento de mensajes cortos         |
+ ** | 25 | 2026.10.14 | gsosa       | Paquetes binarios en los puertos        |
+ ** | 24 | 2026.10.14 | gsosa       | Control de flujo con XON y XOFF         |
+ ** | 23 | 2026.10.14 | gsosa       | Velocidad con divisor fraccional        |
+ ** | 22 | 2026.10.14 | gsosa       | Varios puertos seriales independientes  |
+ ** | 21 | 2026.10.14 | gsosa       | Avisos de transmisión completa          |
+ ** | 20 | 2026.10.14 | gsosa       | Cola de transmisión para avisos urgentes|
+ ** | 19 | 2026.10.14 | gsosa       | Mensajes en bloques de memoria propios  |
+ ** | 18 | 2026.10.14 | gsosa       | Comando con el uso de las pilas         |
+ ** | 17 | 2026.10.14 | gsosa       | Contador de segundos sin tarea Aumento  |
+ ** | 16 | 2026.10.14 | gsosa       | Bajo consumo en la tarea ociosa         |
+ ** | 15 | 2026.10.14 | gsosa       | Teclado por interrupciones de los pines |
+ ** | 14 | 2026.10.14 | gsosa       | Traza de ejecución de las tareas        |
+ ** | 13 | 2026.10.14 | gsosa       | Medición de tiempos de la transmisión   |
+ ** | 12 | 2026.10.14 | gsosa       | Interface de transmisión en serial.h    |
+ ** | 11 | 2026.10.14 | gsosa       | Envio de mensajes en fragmentos         |
+ ** | 10 | 2026.10.14 | gsosa       | Envio de bloques sin recorrer cadenas   |
+ ** |  9 | 2026.10.14 | gsosa       | Envio de bloques de cualquier longitud  |
+ ** |  8 | 2026.10.14 | gsosa       | Recepción de tramas por interrupciones  |
+ ** |  7 | 2026.10.14 | gsosa       | Transmisión desde varias tareas         |
+ ** |  6 | 2026.10.14 | gsosa       | Cola circular de transmisión            |
+ ** |  5 | 2026.10.14 | gsosa       | Transmisión por DMA de cadenas largas   |
+ ** |  4 | 2026.10.14 | gsosa       | Transmisión usando la FIFO de la uart   |
+ ** |  3 | 2018.09.19 | gsosa       | Adaptación código final                 |
+ ** |  2 | 2017.10.21 | evolentini  | Correción en el formato del archivo     |
+ ** |  1 | 2017.09.16 | evolentini  | Version inicial del archivo             |
+ ** 
+ ** @defgroup ejemplos Proyectos de ejemplo
+ ** @brief Proyectos de ejemplo de la Especialización en Sistemas Embebidos
+ ** @{ 
+ */
+
+/* === Inclusiones de cabeceras ============================================ */
+#include <stdint.h>
+#include <string.h>
+#include "serial.h"
+#include "Serial_Cfg.h"
+#include "cola.h"
+#include "lote.h"
+#include "memoria.h"
+#include "bloques.h"
+#include "divisor.h"
+#include "formato.h"
+#include "paquete.h"
+#include "buzon.h"
+#include "medicion.h"
+#include "traza.h"
+
+//! Numero de este archivo en los identificadores de la bitacora
+#define BITACORA_ARCHIVO      1
+#include "bitacora.h"
+
+#include "tiempo.h"
+#include "pila.h"
+#include "led.h"
+#include "switch.h"
+#include "uart.h"
+#include "os.h"
+
+/* === Definicion y Macros ================================================= */
+
+//! Cantidad de bytes que admite la FIFO de transmisión de la uart
+#define FIFO_TX_LONGITUD   16
+
+/** @brief Tamaño de la cola de transmisión
+ **
+ ** Cantidad de bytes que las tareas pueden encolar sin esperar a que se
+ ** complete la transmisión. Debe ser una potencia de dos.
+ */
+#ifndef SERIAL_TX_LONGITUD
+   #define SERIAL_TX_LONGITUD 512
+#endif
+
+#if !COLA_TAMANIO_VALIDO(SERIAL_TX_LONGITUD)
+   #error "SERIAL_TX_LONGITUD debe ser una potencia de dos"
+#endif
+
+/** @brief Tamaño de la cola de recepción
+ **
+ ** Cantidad de bytes de las tramas recibidas que esperan ser procesadas,
+ ** incluyendo un byte de longitud por trama. Debe ser una potencia de dos.
+ */
+#ifndef SERIAL_RX_LONGITUD
+   #define SERIAL_RX_LONGITUD 256
+#endif
+
+#if !COLA_TAMANIO_VALIDO(SERIAL_RX_LONGITUD)
+   #error "SERIAL_RX_LONGITUD debe ser una potencia de dos"
+#endif
+
+//! Tramas recibidas separadas por un caracter delimitador
+#define TRAMA_DELIMITADA   0
+
+//! Tramas recibidas precedidas por un byte con su longitud
+#define TRAMA_LONGITUD     1
+
+/** @brief Formato de las tramas recibidas
+ **
+ ** Con @ref TRAMA_DELIMITADA cada trama termina con el caracter
+ ** @ref SERIAL_RX_DELIMITADOR, que no se entrega a la aplicación, y se
+ ** ignoran las tramas vacias. Con @ref TRAMA_LONGITUD el primer byte de
+ ** cada trama indica la cantidad de bytes que le siguen.
+ */
+#ifndef SERIAL_RX_TRAMA
+   #define SERIAL_RX_TRAMA    TRAMA_DELIMITADA
+#endif
+
+//! Caracter que termina las tramas en el formato @ref TRAMA_DELIMITADA
+#ifndef SERIAL_RX_DELIMITADOR
+   #define SERIAL_RX_DELIMITADOR '\n'
+#endif
+
+/** @brief Habilita los paquetes binarios en los puertos RS-485 y RS-232
+ **
+ ** Cuando vale 1 las tramas de esos puertos se separan con
+ ** @ref PAQUETE_DELIMITADOR en lugar de @ref SERIAL_RX_DELIMITADOR y la
+ ** tarea Recepcion devuelve como paquete los datos de cada paquete valido.
+ ** La consola sigue recibiendo comandos de texto.
+ */
+#ifndef SERIAL_PAQUETES
+   #define SERIAL_PAQUETES    0
+#endif
+
+#if SERIAL_PAQUETES && (SERIAL_RX_TRAMA != TRAMA_DELIMITADA)
+   #error "SERIAL_PAQUETES necesita SERIAL_RX_TRAMA igual a TRAMA_DELIMITADA"
+#endif
+
+//! Delimitador de las tramas de los puertos que no son la consola
+#if SERIAL_PAQUETES
+   #define DELIMITADOR_PUERTOS   PAQUETE_DELIMITADOR
+#else
+   #define DELIMITADOR_PUERTOS   SERIAL_RX_DELIMITADOR
+#endif
+
+//! Longitud maxima de una trama recibida, las mas largas se descartan
+#ifndef SERIAL_RX_TRAMA_MAXIMA
+   #define SERIAL_RX_TRAMA_MAXIMA   128
+#endif
+
+#if (SERIAL_RX_TRAMA_MAXIMA > 255) || (SERIAL_RX_TRAMA_MAXIMA >= SERIAL_RX_LONGITUD)
+   #error "SERIAL_RX_TRAMA_MAXIMA no entra en el byte de longitud o en la cola"
+#endif
+
+/** @brief Habilita el control de flujo por software en todos los puertos
+ **
+ ** Cuando vale 1 los caracteres @ref SERIAL_XOFF y @ref SERIAL_XON recibidos
+ ** no se entregan a la aplicación sino que detienen y reanudan la
+ ** transmisión del puerto con el bit TXEN del registro TER. La uart termina
+ ** el caracter en curso y conserva el resto de la FIFO, la rutina de
+ ** servicio no recibe mas interrupciones de FIFO vacia ni el DMA pedidos
+ ** hasta que se reanuda, por lo que no se pierden datos ni se espera
+ ** activamente. Las uarts de la placa no tienen las lineas RTS y CTS, el
+ ** control automatico por hardware solo esta disponible en la uart 1. No se
+ ** puede combinar con las tramas con longitud, los paquetes, la traza ni la
+ ** bitacora, porque sus bytes binarios pueden coincidir con XON o XOFF.
+ */
+#ifndef SERIAL_XONXOFF
+   #define SERIAL_XONXOFF     0
+#endif
+
+//! Caracter que reanuda la transmisión con @ref SERIAL_XONXOFF
+#define SERIAL_XON            0x11
+
+//! Caracter que detiene la transmisión con @ref SERIAL_XONXOFF
+#define SERIAL_XOFF           0x13
+
+#if SERIAL_XONXOFF && (SERIAL_RX_TRAMA == TRAMA_LONGITUD)
+   #error "SERIAL_XONXOFF necesita tramas de texto, el byte de longitud puede ser XON o XOFF"
+#endif
+
+/* Los paquetes codificados pueden contener XON o XOFF en ambos sentidos */
+#if SERIAL_XONXOFF && SERIAL_PAQUETES
+   #error "SERIAL_XONXOFF necesita tramas de texto, los paquetes pueden contener XON o XOFF"
+#endif
+
+/* Los registros binarios de la traza y de la bitacora salen por la consola y
+   un receptor con control de flujo por software actuaria con sus bytes */
+#if SERIAL_XONXOFF && SERIAL_TRAZA
+   #error "SERIAL_XONXOFF necesita tramas de texto, la traza binaria puede contener XON o XOFF"
+#endif
+
+#if SERIAL_XONXOFF && SERIAL_BITACORA
+   #error "SERIAL_XONXOFF necesita tramas de texto, la bitacora binaria puede contener XON o XOFF"
+#endif
+
+/** @brief Ventana de agrupamiento de los mensajes cortos en milisegundos
+ **
+ ** Cuando es mayor que cero los datos encolados con el puerto sin transmitir
+ ** no inician la transmisión hasta que vence la alarma Agrupar o se
+ ** acumulan @ref SERIAL_AGRUPAR_UMBRAL bytes, por lo que muchos mensajes
+ ** cortos salen en una sola rafaga con una sola serie de interrupciones. Los
+ ** avisos urgentes, los avisos de transmisión y @ref DespacharPuerto inician
+ ** la transmisión de inmediato.
+ */
+#ifndef SERIAL_AGRUPAR_VENTANA
+   #define SERIAL_AGRUPAR_VENTANA   0
+#endif
+
+//! Bytes encolados que inician la transmisión sin esperar la ventana
+#ifndef SERIAL_AGRUPAR_UMBRAL
+   #define SERIAL_AGRUPAR_UMBRAL    64
+#endif
+
+#if SERIAL_AGRUPAR_VENTANA && !SERIAL_CFG_AGRUPAR
+   #error "SERIAL_AGRUPAR_VENTANA necesita la alarma Agrupar en el archivo OIL"
+#endif
+
+//! Errores de recepción informados por el registro de estado de la uart
+#define UART_LSR_ERRORES   (UART_LSR_OE | UART_LSR_PE | UART_LSR_FE | UART_LSR_BI)
+
+/** @brief Cantidad de tareas que pueden esperar la transmisión
+ **
+ ** Cada tarea extendida que llama a @ref EsperarSalida ocupa un lugar
+ ** mientras espera, por lo que alcanza con la cantidad de tareas extendidas
+ ** que transmiten datos. Si no queda lugar la tarea no espera el evento
+ ** Completo sino que consulta la cola llamando a Schedule, que solo cede el
+ ** procesador a las tareas de mayor prioridad.
+ */
+#ifndef SERIAL_ESPERAS
+   #define SERIAL_ESPERAS     4
+#endif
+
+/** @brief Cantidad de avisos de transmisión completa pendientes
+ **
+ ** Cada llamada a @ref AvisarTransmision ocupa un lugar hasta que se da el
+ ** aviso, por lo que alcanza con la cantidad de transmisiones que se pueden
+ ** esperar al mismo tiempo sin bloquear a las tareas.
+ */
+#ifndef SERIAL_AVISOS
+   #define SERIAL_AVISOS      4
+#endif
+
+/** @brief Tamaño de la cola de transmisión de los avisos urgentes
+ **
+ ** Los avisos urgentes se envian antes que los datos normales y entre dos
+ ** datos normales solo se envian los avisos que estaban encolados al iniciar
+ ** el lote, por lo que la demora de los datos normales esta acotada por este
+ ** tamaño. Debe ser una potencia de dos.
+ */
+#ifndef SERIAL_URGENTE_LONGITUD
+   #define SERIAL_URGENTE_LONGITUD   64
+#endif
+
+#if !COLA_TAMANIO_VALIDO(SERIAL_URGENTE_LONGITUD)
+   #error "SERIAL_URGENTE_LONGITUD debe ser una potencia de dos"
+#endif
+
+/** @brief Cantidad de limites entre mensajes normales que se recuerdan
+ **
+ ** Cuando vale 0 los avisos urgentes se intercalan al inicio de cualquier
+ ** bloque de la FIFO y su demora esta acotada por un solo bloque, pero pueden
+ ** partir un mensaje normal. En otro caso solo se intercalan en los limites
+ ** entre los mensajes normales y su demora esta acotada por el mensaje mas
+ ** largo, como maximo @ref SERIAL_TX_LONGITUD bytes. Debe ser una potencia de
+ ** dos y si se completa los mensajes siguientes se unen al anterior.
+ */
+#ifndef SERIAL_URGENTE_LIMITES
+   #define SERIAL_URGENTE_LIMITES    16
+#endif
+
+#if (SERIAL_URGENTE_LIMITES != 0) && !COLA_TAMANIO_VALIDO(SERIAL_URGENTE_LIMITES)
+   #error "SERIAL_URGENTE_LIMITES debe ser cero o una potencia de dos"
+#endif
+
+/** @brief Habilita la transmisión por DMA de los bloques largos
+ **
+ ** Cuando vale 1 los bloques contiguos de @ref SERIAL_DMA_UMBRAL bytes o mas
+ ** pendientes en la cola de transmisión se entregan a un canal del GPDMA
+ ** directamente desde la memoria de la cola, sin interrupciones por cada
+ ** bloque de la FIFO, y el evento Completo se genera en la interrupción de
+ ** fin de transferencia. Los bloques cortos se siguen enviando por
+ ** interrupciones de la uart.
+ */
+#ifndef SERIAL_DMA
+   #define SERIAL_DMA         0
+#endif
+
+//! Longitud minima de un bloque para enviarlo por DMA
+#ifndef SERIAL_DMA_UMBRAL
+   #define SERIAL_DMA_UMBRAL  32
+#endif
+
+//! Cantidad maxima de bytes de una transferencia del GPDMA
+#define DMA_TRANSFERENCIA_MAXIMA   4095
+
+//! Identificador en la traza de la rutina de servicio de la uart
+#define TRAZA_EVENTO_SERIAL   0
+
+//! Identificador en la traza de la rutina de servicio del DMA
+#define TRAZA_EVENTO_DMA      1
+
+//! Identificador en la traza de la rutina de servicio del puerto RS-485
+#define TRAZA_EVENTO_RS485    2
+
+//! Identificador en la traza de la rutina de servicio del puerto RS-232
+#define TRAZA_EVENTO_RS232    3
+
+//! Velocidad inicial de la consola en baudios
+#ifndef SERIAL_CONSOLA_BAUDIOS
+   #define SERIAL_CONSOLA_BAUDIOS  115200
+#endif
+
+//! Velocidad del puerto RS-485 en baudios
+#ifndef SERIAL_RS485_BAUDIOS
+   #define SERIAL_RS485_BAUDIOS  115200
+#endif
+
+//! Velocidad del puerto RS-232 en baudios
+#ifndef SERIAL_RS232_BAUDIOS
+   #define SERIAL_RS232_BAUDIOS  115200
+#endif
+
+//! Nivel de disparo inicial de la recepción de la consola, ver @ref disparo_t
+#ifndef SERIAL_CONSOLA_DISPARO
+   #define SERIAL_CONSOLA_DISPARO   DISPARO_8_BYTES
+#endif
+
+//! Nivel de disparo inicial de la recepción del puerto RS-485
+#ifndef SERIAL_RS485_DISPARO
+   #define SERIAL_RS485_DISPARO     DISPARO_8_BYTES
+#endif
+
+//! Nivel de disparo inicial de la recepción del puerto RS-232
+#ifndef SERIAL_RS232_DISPARO
+   #define SERIAL_RS232_DISPARO     DISPARO_8_BYTES
+#endif
+
+#if SERIAL_ESTADISTICAS
+   //! Suma un valor a un contador de estadisticas de un puerto
+   #define ESTADISTICA_SUMAR(puerto, campo, valor) \
+      ((puerto)->estadisticas.campo += (valor))
+
+   //! Registra un valor en un contador de estadisticas si supera al maximo
+   #define ESTADISTICA_MAXIMO(puerto, campo, valor) do { \
+      uint32_t valor_ = (valor); \
+      if (valor_ > (puerto)->estadisticas.campo) { \
+         (puerto)->estadisticas.campo = valor_; \
+      } \
+   } while (0)
+#else
+   #define ESTADISTICA_SUMAR(puerto, campo, valor)
+   #define ESTADISTICA_MAXIMO(puerto, campo, valor)
+#endif
+
+//! Bits del registro FCR que se escriben junto con el nivel de disparo
+#if SERIAL_DMA
+   #define FCR_MODO           (UART_FCR_FIFO_EN | UART_FCR_DMAMODE_SEL)
+#else
+   #define FCR_MODO           (UART_FCR_FIFO_EN)
+#endif
+
+/* Los puertos habilitados deben tener su rutina de servicio en el OIL */
+#if !SERIAL_CFG_CONSOLA
+   #error "El archivo OIL no declara la rutina de servicio EventoSerial"
+#endif
+
+#if SERIAL_RS485 && !SERIAL_CFG_RS485
+   #error "SERIAL_RS485 necesita la rutina de servicio EventoRs485 en el archivo OIL"
+#endif
+
+#if SERIAL_RS232 && !SERIAL_CFG_RS232
+   #error "SERIAL_RS232 necesita la rutina de servicio EventoRs232 en el archivo OIL"
+#endif
+
+/* La rutina del DMA modifica el estado de transmisión de todos los puertos,
+   por lo que no puede interrumpir a sus rutinas ni ser interrumpida */
+#if SERIAL_DMA && (SERIAL_CFG_DMA_PRIORIDAD != SERIAL_CFG_CONSOLA_PRIORIDAD)
+   #error "EventoDma debe tener la prioridad de EventoSerial en el archivo OIL"
+#endif
+
+#if SERIAL_DMA && SERIAL_RS485 && (SERIAL_CFG_DMA_PRIORIDAD != SERIAL_CFG_RS485_PRIORIDAD)
+   #error "EventoDma debe tener la prioridad de EventoRs485 en el archivo OIL"
+#endif
+
+#if SERIAL_DMA && SERIAL_RS232 && (SERIAL_CFG_DMA_PRIORIDAD != SERIAL_CFG_RS232_PRIORIDAD)
+   #error "EventoDma debe tener la prioridad de EventoRs232 en el archivo OIL"
+#endif
+
+/** @brief Atiende la uart de la consola con el Cortex-M0
+ **
+ ** Cuando vale 1 el coprocesador ejecuta m0/src/coprocesador.c, vacia las
+ ** colas de transmisión de la consola en la uart y le pasa los caracteres
+ ** recibidos por el buzon de buzon.h. Las tareas encolan con las mismas
+ ** funciones y el M4 solo atiende el aviso del coprocesador, en el que arma
+ ** las tramas y notifica a las tareas que esperan. Los mensajes en bloques se
+ ** copian en la cola, el nivel de disparo adaptativo no se aplica y las
+ ** estadisticas de la consola no cuentan los bytes enviados. La velocidad y
+ ** el nivel de disparo de la consola no se pueden cambiar.
+ */
+#ifndef SERIAL_COPROCESADOR
+   #define SERIAL_COPROCESADOR   0
+#endif
+
+//! Dirección de la imagen del coprocesador, alineada a 4 KB
+#ifndef SERIAL_COPROCESADOR_IMAGEN
+   #define SERIAL_COPROCESADOR_IMAGEN  0x1B000000
+#endif
+
+/** @brief Tamaño de la cola de caracteres recibidos por el coprocesador
+ **
+ ** Cada caracter ocupa dos bytes, el estado de la linea y el dato. Debe ser
+ ** una potencia de dos.
+ */
+#ifndef SERIAL_COPROCESADOR_RX_LONGITUD
+   #define SERIAL_COPROCESADOR_RX_LONGITUD   256
+#endif
+
+#if !COLA_TAMANIO_VALIDO(SERIAL_COPROCESADOR_RX_LONGITUD)
+   #error "SERIAL_COPROCESADOR_RX_LONGITUD debe ser una potencia de dos"
+#endif
+
+#if SERIAL_COPROCESADOR && !SERIAL_CFG_COPROCESADOR
+   #error "SERIAL_COPROCESADOR necesita la rutina de servicio EventoCoprocesador en el archivo OIL"
+#endif
+
+/* El aviso del coprocesador modifica el estado de la consola igual que su
+   rutina de servicio */
+#if SERIAL_COPROCESADOR && (SERIAL_CFG_COPROCESADOR_PRIORIDAD != SERIAL_CFG_CONSOLA_PRIORIDAD)
+   #error "EventoCoprocesador debe tener la prioridad de EventoSerial en el archivo OIL"
+#endif
+
+/* El M4 no puede cambiar la configuración de la uart que atiende el
+   coprocesador, porque suspender sus interrupciones no detiene al M0 */
+#if SERIAL_COPROCESADOR
+   #define UART_PROPIA(numero)   (((numero) != PUERTO_CONSOLA) && ((numero) < PUERTOS_CANTIDAD))
+#else
+   #define UART_PROPIA(numero)   TRUE
+#endif
+
+/** @brief Habilita la lectura del teclado por interrupciones de los pines
+ **
+ ** Cuando vale 1 cada flanco de una tecla arranca la alarma Antirrebote, que
+ ** activa la tarea Teclado una sola vez cuando pasa el tiempo de rebote, en
+ ** lugar de revisar el teclado periodicamente con la alarma RevisarTeclado.
+ */
+#ifndef TECLADO_INTERRUPCION
+   #define TECLADO_INTERRUPCION  1
+#endif
+
+/** @brief Tiempo de rebote de las teclas en ticks del sistema operativo
+ **
+ ** La tarea Teclado lee las teclas este tiempo despues del primer flanco,
+ ** los flancos de los rebotes que llegan mientras tanto se ignoran.
+ */
+#ifndef TECLADO_ANTIRREBOTE
+   #define TECLADO_ANTIRREBOTE   5
+#endif
+
+/** @brief Habilita el bajo consumo en la tarea ociosa
+ **
+ ** Cuando vale 1 la tarea Ocioso detiene el procesador con la instrucción WFI
+ ** cada vez que no tiene trabajo, hasta la siguiente interrupción. El tick
+ ** del sistema operativo sigue despertando al procesador cada milisegundo.
+ */
+#ifndef OCIOSO_BAJO_CONSUMO
+   #define OCIOSO_BAJO_CONSUMO   1
+#endif
+
+//! Cantidad de teclas de la EDU-CIAA, cada una usa un canal de PININT
+#define TECLAS_CANTIDAD       4
+
+/* === Declaraciones de tipos de datos internos ============================ */
+
+/** @brief Estructura de datos de una tarea que espera la transmisión
+ **
+ ** La tarea registra la cantidad de bytes que tienen que salir de la cola
+ ** para que se complete la transmisión de sus datos y la rutina de servicio
+ ** le envia el evento Completo cuando se alcanza ese valor.
+ */
+typedef struct {
+   volatile TaskType tarea;      /** < Tarea que espera o INVALID_TASK */
+   volatile uint32_t objetivo;   /** < Valor de salida que espera la tarea */
+} espera_t;
+
+/** @brief Estructura de datos de un aviso de transmisión completa
+ **
+ ** Similar a @ref espera_t pero para las tareas que no se bloquean, la
+ ** rutina de servicio libera el lugar y luego llama a la función y activa a
+ ** la tarea registradas.
+ */
+typedef struct {
+   volatile bool ocupado;        /** < El lugar tiene un aviso pendiente */
+   uint32_t objetivo;            /** < Valor de salida que espera el aviso */
+   TaskType tarea;               /** < Tarea que se activa o INVALID_TASK */
+   completo_t funcion;           /** < Función que se llama o NULL */
+   void * parametro;             /** < Parametro de la función */
+} aviso_t;
+
+//! Estructura de datos con el pin de GPIO de una tecla
+typedef struct {
+   uint8_t puerto;               /** < Puerto de GPIO de la tecla */
+   uint8_t pin;                  /** < Pin de GPIO de la tecla */
+} tecla_t;
+
+/** @brief Estructura de datos de un mensaje entregado en un bloque de memoria
+ **
+ ** El mensaje ocupa un único byte en la cola de transmisión que solo reserva
+ ** su lugar, cuando la salida de la cola alcanza esa posición la rutina de
+ ** servicio transmite los datos desde el bloque y luego lo libera.
+ */
+typedef struct {
+   uint32_t posicion;            /** < Posición de la cola del mensaje */
+   const uint8_t * datos;        /** < Bloque con los datos del mensaje */
+   uint32_t cantidad;            /** < Cantidad de bytes del mensaje */
+} mensaje_t;
+
+/** @brief Estructura de datos de la configuración de un puerto serial
+ **
+ ** Las configuraciones de los puertos son constantes y quedan en la memoria
+ ** flash en la tabla @ref configuraciones. La uart, la interrupción, el reloj,
+ ** la conexión de DMA, la tarea y el evento de cada puerto se obtienen de
+ ** Serial_Cfg.h, que FreeOSEK genera a partir del archivo OIL.
+ */
+typedef struct {
+   LPC_USART_T * uart;           /** < Uart del puerto */
+   IRQn_Type interrupcion;       /** < Interrupción de la uart */
+   void (*iniciar)(void);        /** < Configura los pines y el formato */
+   CHIP_CCU_CLK_T reloj;         /** < Reloj base de la uart */
+   uint32_t baudios;             /** < Velocidad inicial del puerto */
+   disparo_t disparo;            /** < Nivel de disparo inicial de la recepción */
+   uint8_t conexion_dma;         /** < Conexión del GPDMA de la transmisión */
+   TaskType tarea;               /** < Tarea que procesa las tramas recibidas */
+   EventMaskType evento;         /** < Evento que notifica las tramas recibidas */
+   uint8_t traza;                /** < Identificador de la rutina en la traza */
+   uint8_t delimitador;          /** < Caracter que termina las tramas recibidas */
+   const char * nombre;          /** < Nombre del puerto en los informes */
+} puerto_config_t;
+
+/** @brief Estructura de datos de un puerto serial
+ **
+ ** Contiene el estado de las colas de transmisión y recepción de un puerto,
+ ** por lo que cada puerto transmite y recibe en forma independiente desde su
+ ** propia rutina de servicio. La configuración se asigna en la tabla
+ ** @ref puertos y el resto de los campos los inicia @ref ConfigurarPuerto.
+ */
+typedef struct {
+   const puerto_config_t * config;     /** < Configuración del puerto */
+   uint32_t baudios;             /** < Velocidad actual del puerto */
+   disparo_t politica;           /** < Nivel de disparo pedido o adaptativo */
+   disparo_t nivel;              /** < Nivel de disparo actual de la FIFO */
+
+   uint8_t buffer_tx[SERIAL_TX_LONGITUD];       /** < Memoria de la cola */
+   cola_t cola;                  /** < Datos pendientes de envio */
+   espera_t esperas[SERIAL_ESPERAS];            /** < Tareas que esperan */
+   aviso_t avisos[SERIAL_AVISOS];               /** < Avisos pendientes */
+   uint8_t buffer_urgente[SERIAL_URGENTE_LONGITUD];   /** < Memoria urgente */
+   cola_t urgente;               /** < Avisos urgentes pendientes de envio */
+#if SERIAL_URGENTE_LIMITES
+   uint32_t limites[SERIAL_URGENTE_LIMITES];    /** < Fines de los mensajes */
+#endif
+   lote_t lote;                  /** < Intercalado de los avisos urgentes */
+   mensaje_t mensajes[BLOQUES_CANTIDAD];        /** < Mensajes en bloques */
+   volatile uint32_t mensajes_entrada; /** < Mensajes entregados por las tareas */
+   volatile uint32_t mensajes_salida;  /** < Mensajes transmitidos por la rutina */
+   uint32_t enviados_mensaje;    /** < Bytes enviados del mensaje actual */
+#if SERIAL_AGRUPAR_VENTANA
+   volatile bool agrupando;      /** < Hay datos esperando la ventana */
+#endif
+#if SERIAL_DMA
+   uint8_t canal_dma;            /** < Canal del GPDMA de la transmisión */
+   uint32_t enviados_dma;        /** < Bytes de la transferencia en curso */
+#endif
+
+   uint8_t buffer_rx[SERIAL_RX_LONGITUD];       /** < Memoria de la cola */
+   cola_t recepcion;             /** < Tramas recibidas pendientes */
+   uint32_t armado;              /** < Bytes de la trama en armado */
+   bool descartando;             /** < Se descarta la trama actual */
+#if SERIAL_RX_TRAMA == TRAMA_LONGITUD
+   uint32_t faltantes;           /** < Bytes que faltan de la trama en armado */
+#endif
+
+#if SERIAL_MEDICION
+   uint32_t marca_encolado;      /** < Momento de encolado con la cola vacia */
+   volatile bool primer_byte_pendiente;   /** < Se espera el primer byte */
+#endif
+#if SERIAL_ESTADISTICAS
+   estadisticas_t estadisticas;  /** < Contadores del puerto */
+#endif
+} puerto_t;
+
+/* === Declaraciones de funciones internas ================================= */
+
+/** @brief Carga la FIFO de transmisión de la uart
+ **
+ ** Esta función se llama desde la rutina de servicio cuando la FIFO de
+ ** transmisión de la uart esta vacia y copia en la misma hasta
+ ** @ref FIFO_TX_LONGITUD bytes pendientes en la cola de transmisión.
+ */
+EN_RAM void LlenarFifo(puerto_t * puerto);
+
+/** @brief Obtiene el mensaje en bloque mas antiguo pendiente de transmisión
+ **
+ ** @return Puntero al descriptor del mensaje o NULL si no hay mensajes.
+ */
+EN_RAM mensaje_t * MensajePendiente(puerto_t * puerto);
+
+/** @brief Cantidad de bytes pendientes de transmisión en ambas colas
+ */
+EN_RAM uint32_t DatosPendientes(puerto_t * puerto);
+
+/** @brief Obtiene el siguiente tramo contiguo de datos a transmitir
+ **
+ ** El tramo corresponde al lote de avisos urgentes en curso, al resto del
+ ** mensaje en bloque que tiene el lugar en la salida de la cola o a los
+ ** datos de la cola hasta el próximo mensaje o limite.
+ **
+ ** @param[out] datos Puntero al inicio del tramo.
+ ** @return Cantidad de bytes del tramo.
+ */
+EN_RAM uint32_t SiguienteTramo(puerto_t * puerto, const uint8_t ** datos);
+
+/** @brief Descarta los bytes ya transmitidos del tramo actual
+ **
+ ** @param[in] cantidad Cantidad de bytes transmitidos, como maximo la
+ **            cantidad informada por @ref SiguienteTramo.
+ */
+EN_RAM void DescartarTramo(puerto_t * puerto, uint32_t cantidad);
+
+#if SERIAL_DMA
+/** @brief Inicia la transmisión por DMA del siguiente bloque de la cola
+ **
+ ** @return Indica si se inició una transferencia porque el bloque contiguo
+ **         pendiente en la cola tiene @ref SERIAL_DMA_UMBRAL bytes o mas.
+ */
+EN_RAM bool IniciarDma(puerto_t * puerto);
+#endif
+
+#if SERIAL_RS485
+/** @brief Configura los pines, el formato y el control de dirección del
+ **        puerto RS-485 de la EDU-CIAA
+ */
+void IniciarRs485(void);
+#endif
+
+#if SERIAL_RS232
+/** @brief Configura los pines y el formato del puerto RS-232 de la EDU-CIAA
+ */
+void IniciarRs232(void);
+#endif
+
+/** @brief Inicia las colas y configura la uart de un puerto
+ **
+ ** @param[in] puerto Puerto que se configura.
+ */
+void ConfigurarPuerto(puerto_t * puerto);
+
+/** @brief Carga los divisores de velocidad en la uart de un puerto
+ **
+ ** Mientras el bit DLAB esta activo los registros de datos y de
+ ** interrupciones se acceden como el divisor, por lo que la carga se hace con
+ ** las interrupciones suspendidas.
+ **
+ ** @param[in] puerto Puerto que se configura.
+ ** @param[in] divisor Valores calculados con @ref DivisorCalcular.
+ */
+void AplicarDivisor(puerto_t * puerto, const divisor_t * divisor);
+
+/** @brief Carga un nivel de disparo en la FIFO de recepción de un puerto
+ **
+ ** @param[in] puerto Puerto que se configura.
+ ** @param[in] nivel Nivel de disparo, sin @ref DISPARO_ADAPTATIVO.
+ */
+EN_RAM void AplicarDisparo(puerto_t * puerto, disparo_t nivel);
+
+/** @brief Ajusta el nivel de disparo adaptativo segun la causa de la interrupción
+ **
+ ** Sube un paso el nivel cuando la FIFO lo alcanzó y lo baja al minimo
+ ** cuando la interrupción se produjo por el tiempo de espera entre
+ ** caracteres, que indica que la linea quedó libre.
+ **
+ ** @param[in] puerto Puerto que genero la interrupción.
+ ** @param[in] identificacion Valor del registro IIR de la uart.
+ */
+EN_RAM void AdaptarDisparo(puerto_t * puerto, uint32_t identificacion);
+
+/** @brief Atiende la interrupción de la uart de un puerto
+ **
+ ** Esta función es el cuerpo común de las rutinas de servicio de todos los
+ ** puertos.
+ **
+ ** @param[in] puerto Puerto que genero la interrupción.
+ */
+EN_RAM void AtenderPuerto(puerto_t * puerto);
+
+/** @brief Espera que la salida de la cola de un puerto alcance un objetivo
+ **
+ ** @param[in] puerto Puerto cuya transmisión se espera.
+ ** @param[in] objetivo Valor del indice de salida que se espera.
+ */
+void EsperarObjetivo(puerto_t * puerto, uint32_t objetivo);
+
+/** @brief Inicia la transmisión de los datos pendientes de un puerto
+ **
+ ** La rutina de servicio es el unico consumidor de las colas, por lo que la
+ ** transmisión se inicia forzando la atención de la interrupción.
+ **
+ ** @param[in] puerto Puerto que transmite.
+ */
+void IniciarTransmision(puerto_t * puerto);
+
+#if SERIAL_AGRUPAR_VENTANA
+/** @brief Decide si los datos recien encolados esperan la ventana
+ **
+ ** Los datos esperan solo si el puerto no esta transmitiendo y no alcanzan el
+ ** umbral, en ese caso se arranca la alarma Agrupar si no esta corriendo. Se
+ ** llama con el recurso RecursoSerial tomado.
+ **
+ ** @param[in] puerto Puerto en el que se encolaron los datos.
+ ** @return Indica si los datos quedan esperando la ventana.
+ */
+bool AgruparTransmision(puerto_t * puerto);
+#endif
+
+/** @brief Agrega un byte recibido a la trama en armado
+ **
+ ** Esta función se llama desde la rutina de servicio por cada byte recibido
+ ** sin errores. Los bytes se copian en la cola de recepción detras del byte
+ ** de longitud de la trama, pero solo se publican cuando la trama se completa.
+ **
+ ** @param[in] dato Byte recibido por la uart.
+ ** @return Indica si se completó una trama.
+ */
+EN_RAM bool ArmarTrama(puerto_t * puerto, uint8_t dato);
+
+/** @brief Recepción de caracteres en una interrupción
+ **
+ ** Esta función se llama durante la rutina de servicio de interrupcion y
+ ** vacia la FIFO de recepción de la uart. Se llama tanto al alcanzar el
+ ** nivel de disparo de la FIFO como por el tiempo de espera entre caracteres.
+ ** Si un byte llega con errores se descarta la trama que lo contiene.
+ **
+ ** @return Indica si se completó al menos una trama.
+ */
+EN_RAM bool RecibirCaracteres(puerto_t * puerto);
+
+/** @brief Procesa un caracter recibido con el estado de la linea
+ **
+ ** Cuenta los errores, atiende el control de flujo y agrega el caracter a la
+ ** trama en armado, o la descarta si el caracter llegó con errores.
+ **
+ ** @param[in] puerto Puerto que recibió el caracter.
+ ** @param[in] estado Registro de estado de la linea leido con el caracter.
+ ** @param[in] dato Caracter recibido.
+ ** @return Indica si se completó una trama.
+ */
+EN_RAM bool ProcesarCaracter(puerto_t * puerto, uint32_t estado, uint8_t dato);
+
+#if SERIAL_COPROCESADOR
+/** @brief Procesa los caracteres que recibió el coprocesador
+ **
+ ** @param[in] puerto Puerto de la consola.
+ ** @return Indica si se completó al menos una trama.
+ */
+EN_RAM bool RecibirCoprocesador(puerto_t * puerto);
+
+/** @brief Entrega la uart de la consola al coprocesador y lo arranca
+ **
+ ** Completa el descriptor del buzon con las colas de la consola, deshabilita
+ ** la interrupción de la uart en el M4 y libera al M0 del reset con su
+ ** imagen en @ref SERIAL_COPROCESADOR_IMAGEN.
+ */
+void ArrancarCoprocesador(void);
+#endif
+
+/** @brief Lee la siguiente trama recibida
+ **
+ ** Esta función solo la puede llamar la tarea Recepcion, que es el unico
+ ** consumidor de la cola de recepción.
+ **
+ ** @param[out] datos Puntero donde se copia la trama.
+ ** @param[in] maximo Cantidad maxima de bytes a copiar, el resto de la trama
+ **            se descarta.
+ ** @return Cantidad de bytes copiados, cero si no hay tramas pendientes.
+ */
+uint32_t RecibirTrama(puerto_t * puerto, uint8_t * datos, uint32_t maximo);
+
+/** @brief Notifica a las tareas cuyos datos ya se transmitieron
+ **
+ ** Esta función se llama desde las rutinas de servicio despues de retirar
+ ** datos de la cola de transmisión y envia el evento Completo a cada tarea
+ ** registrada por @ref EsperarSalida que alcanzó su objetivo.
+ */
+EN_RAM void NotificarEsperas(puerto_t * puerto);
+
+/** @brief Envio de caracteres en una interrupcion.
+ **
+ ** Esta función se llama durante la rutina de servicio de interrupcion cuando
+ ** se vacia la FIFO de transmisión y carga en la misma el siguiente bloque de
+ ** la cola de transmisión, o inicia una transferencia por DMA.
+ **
+ ** @return Indica si se retiraron datos de la cola de transmisión.
+ */
+EN_RAM bool EnviarCaracter(puerto_t * puerto);
+
+#if TECLADO_INTERRUPCION
+/** @brief Configura las interrupciones de los pines de las teclas
+ **
+ ** Asigna a cada tecla el canal de PININT de su rutina de servicio con
+ ** interrupción en ambos flancos, para detectar pulsaciones y liberaciones.
+ */
+void ConfigurarTeclas(void);
+
+/** @brief Atiende el flanco de una tecla
+ **
+ ** Esta función se llama desde las rutinas de servicio de los canales de
+ ** PININT y arranca la alarma Antirrebote si no esta corriendo.
+ **
+ ** @param[in] canal Canal de PININT que detectó el flanco.
+ */
+void AtenderTecla(uint8_t canal);
+#endif
+
+/** @brief Compara una trama recibida con el nombre de un comando
+ **
+ ** @param[in] trama Datos de la trama recibida.
+ ** @param[in] cantidad Cantidad de bytes de la trama.
+ ** @param[in] nombre Nombre del comando, se ignora un retorno de carro al
+ **            final de la trama que agregan algunas terminales.
+ ** @return Indica si la trama es el comando.
+ */
+bool EsComando(const uint8_t * trama, uint32_t cantidad, const char * nombre);
+
+/** @brief Compara una trama con un comando seguido de un argumento numerico
+ **
+ ** @param[in] trama Puntero a la trama recibida.
+ ** @param[in] cantidad Cantidad de bytes de la trama.
+ ** @param[in] nombre Nombre del comando, separado del argumento por un
+ **            espacio. Se ignora un retorno de carro al final de la trama.
+ ** @param[out] argumento Valor decimal del argumento.
+ ** @return Indica si la trama es el comando con un argumento valido.
+ */
+bool EsComandoNumero(const uint8_t * trama, uint32_t cantidad, const char * nombre,
+   uint32_t * argumento);
+
+/** @brief Ejecuta el comando de una trama recibida
+ **
+ ** El comando "baudios" seguido de una velocidad confirma la velocidad nueva
+ ** y cambia la de la consola cuando termina de transmitir la respuesta, o
+ ** informa que no esta disponible si no se puede obtener con error aceptable.
+ ** El comando "disparo" seguido de 1, 4, 8 o 14 fija el nivel de disparo de
+ ** la recepción de la consola y seguido de 0 lo deja en modo adaptativo.
+ ** El comando "estadisticas" informa los contadores de todos los puertos.
+ **
+ ** @param[in] trama Datos de la trama recibida.
+ ** @param[in] cantidad Cantidad de bytes de la trama.
+ ** @return Indica si la trama era un comando, en caso contrario se devuelve
+ **         como eco.
+ */
+bool EjecutarComando(const uint8_t * trama, uint32_t cantidad);
+
+#if SERIAL_PILAS
+/** @brief Informa por la uart el uso de la pila de cada tarea
+ */
+void InformarPilas(void);
+#endif
+
+#if SERIAL_MEDICION
+/** @brief Informa por la uart los tiempos medidos en la transmisión
+ **
+ ** Envia el minimo, el promedio y el maximo en ciclos de reloj de la duración
+ ** de las rutinas de servicio, de la demora hasta el primer byte de un mensaje
+ ** y de la espera del evento Completo.
+ */
+void InformarMediciones(void);
+#endif
+
+#if SERIAL_ESTADISTICAS
+/** @brief Informa por la uart las estadisticas de todos los puertos
+ **
+ ** Envia una linea con los contadores de cada puerto habilitado.
+ */
+void InformarEstadisticas(void);
+#endif
+
+/** @brief Apaga el led que indica una transmisión en curso
+ **
+ ** Se registra con @ref AvisarTransmision, por lo que se llama en la rutina
+ ** de servicio cuando se completa la transmisión.
+ **
+ ** @param[in] parametro No se utiliza.
+ */
+void ApagarIndicador(void * parametro);
+
+/** @brief Indica que ya no hay un reintento pendiente de la tarea Enviar
+ **
+ ** Se registra con @ref AvisarTransmision junto con la activación de la
+ ** tarea, por lo que se llama en la rutina de servicio justo antes de que
+ ** el aviso vuelva a activarla.
+ **
+ ** @param[in] parametro No se utiliza.
+ */
+void ReintentarEnvio(void * parametro);
+
+/* === Definiciones de variables internas ================================== */
+
+#if SERIAL_COPROCESADOR
+//! Memoria de la cola de caracteres recibidos por el coprocesador
+uint8_t buffer_coprocesador[SERIAL_COPROCESADOR_RX_LONGITUD];
+
+//! Caracteres recibidos por el coprocesador, que es su productor
+cola_t recepcion_coprocesador;
+
+//! Caracteres perdidos por el coprocesador ya sumados a las estadisticas
+uint32_t perdidos_coprocesador;
+#endif
+
+//! Bits del registro FCR para cada nivel de disparo de la recepción
+const uint32_t niveles_disparo[DISPARO_ADAPTATIVO] = {
+   UART_FCR_TRG_LEV0, UART_FCR_TRG_LEV1, UART_FCR_TRG_LEV2, UART_FCR_TRG_LEV3,
+};
+
+//! Cantidad de bytes de cada nivel de disparo, para el comando de la consola
+const uint8_t bytes_disparo[DISPARO_ADAPTATIVO] = { 1, 4, 8, 14 };
+
+//! Configuración de los puertos seriales, en la memoria flash
+const puerto_config_t configuraciones[PUERTOS_CANTIDAD] = {
+   [PUERTO_CONSOLA] = {
+      .uart = SERIAL_CFG_CONSOLA_UART,
+      .interrupcion = SERIAL_CFG_CONSOLA_IRQ,
+      .iniciar = Init_Uart_Ftdi,
+      .reloj = SERIAL_CFG_CONSOLA_RELOJ,
+      .baudios = SERIAL_CONSOLA_BAUDIOS,
+      .disparo = SERIAL_CONSOLA_DISPARO,
+      .conexion_dma = SERIAL_CFG_CONSOLA_DMA,
+      .tarea = SERIAL_CFG_CONSOLA_TAREA,
+      .evento = SERIAL_CFG_CONSOLA_EVENTO,
+      .traza = TRAZA_EVENTO_SERIAL,
+      .delimitador = SERIAL_RX_DELIMITADOR,
+      .nombre = "Consola",
+   },
+#if SERIAL_RS485
+   [PUERTO_RS485] = {
+      .uart = SERIAL_CFG_RS485_UART,
+      .interrupcion = SERIAL_CFG_RS485_IRQ,
+      .iniciar = IniciarRs485,
+      .reloj = SERIAL_CFG_RS485_RELOJ,
+      .baudios = SERIAL_RS485_BAUDIOS,
+      .disparo = SERIAL_RS485_DISPARO,
+      .conexion_dma = SERIAL_CFG_RS485_DMA,
+      .tarea = SERIAL_CFG_RS485_TAREA,
+      .evento = SERIAL_CFG_RS485_EVENTO,
+      .traza = TRAZA_EVENTO_RS485,
+      .delimitador = DELIMITADOR_PUERTOS,
+      .nombre = "RS-485",
+   },
+#endif
+#if SERIAL_RS232
+   [PUERTO_RS232] = {
+      .uart = SERIAL_CFG_RS232_UART,
+      .interrupcion = SERIAL_CFG_RS232_IRQ,
+      .iniciar = IniciarRs232,
+      .reloj = SERIAL_CFG_RS232_RELOJ,
+      .baudios = SERIAL_RS232_BAUDIOS,
+      .disparo = SERIAL_RS232_DISPARO,
+      .conexion_dma = SERIAL_CFG_RS232_DMA,
+      .tarea = SERIAL_CFG_RS232_TAREA,
+      .evento = SERIAL_CFG_RS232_EVENTO,
+      .traza = TRAZA_EVENTO_RS232,
+      .delimitador = DELIMITADOR_PUERTOS,
+      .nombre = "RS-232",
+   },
+#endif
+};
+
+//! Puertos seriales, cada uno con su uart y su rutina de servicio
+puerto_t puertos[PUERTOS_CANTIDAD] = {
+   [PUERTO_CONSOLA] = { .config = &configuraciones[PUERTO_CONSOLA] },
+#if SERIAL_RS485
+   [PUERTO_RS485] = { .config = &configuraciones[PUERTO_RS485] },
+#endif
+#if SERIAL_RS232
+   [PUERTO_RS232] = { .config = &configuraciones[PUERTO_RS232] },
+#endif
+};
+
+//! Puerto de la reserva en curso, solo hay una porque toma el recurso
+puerto_t * reservado;
+
+//! Cantidad de bytes de la reserva en curso
+uint32_t reservados;
+
+//! Cantidad de bytes copiados en la reserva en curso
+uint32_t escritos;
+
+#if SERIAL_AGRUPAR_VENTANA
+//! Indica que la alarma Agrupar esta corriendo
+volatile bool ventana_activa;
+#endif
+
+//! Indica que hay un aviso registrado para volver a activar la tarea Enviar
+volatile bool reintento_envio;
+
+#if TECLADO_INTERRUPCION
+//! Pines de las teclas en el orden de los canales de PININT
+const tecla_t teclas[TECLAS_CANTIDAD] = {
+   { 0, 4 }, { 0, 8 }, { 0, 9 }, { 1, 9 },
+};
+
+//! Indica que la alarma Antirrebote esta corriendo
+volatile bool antirrebote;
+#endif
+
+#if SERIAL_PILAS
+//! Nombres de las tareas para el informe de las pilas
+const char * const nombres_tareas[] = {
+   [Configuracion] = "Configuracion",
+   [Enviar] = "Enviar",
+   [Recepcion] = "Recepcion",
+   [Teclado] = "Teclado",
+   [Ocioso] = "Ocioso",
+};
+#endif
+
+#if SERIAL_MEDICION
+//! Duración de las rutinas de servicio de la transmisión serial
+medicion_t duracion_interrupcion;
+
+//! Demora entre que se encola un mensaje y que sale su primer byte
+medicion_t demora_primer_byte;
+
+//! Demora entre que una tarea espera la transmisión y que la completa
+medicion_t demora_completo;
+#endif
+
+/* === Definiciones de variables externas ================================== */
+
+/* === Definiciones de funciones internas ================================== */
+
+void LlenarFifo(puerto_t * puerto) {
+   const uint8_t * datos;
+   uint32_t cantidad;
+   uint32_t indice;
+   uint32_t libres = FIFO_TX_LONGITUD;
+
+   /* La FIFO se puede completar con varios tramos de la cola y mensajes */
+   cantidad = SiguienteTramo(puerto, &datos);
+   while ((libres > 0) && (cantidad > 0)) {
+      if (cantidad > libres) {
+         cantidad = libres;
+      }
+      for (indice = 0; indice < cantidad; indice++) {
+         Chip_UART_SendByte(puerto->config->uart, datos[indice]);
+      }
+      DescartarTramo(puerto, cantidad);
+      libres -= cantidad;
+      cantidad = SiguienteTramo(puerto, &datos);
+   }
+}
+
+mensaje_t * MensajePendiente(puerto_t * puerto) {
+   mensaje_t * mensaje = NULL;
+
+   if (puerto->mensajes_salida != puerto->mensajes_entrada) {
+      /* El descriptor se completa antes de incrementar la entrada */
+      __DMB();
+      mensaje = &puerto->mensajes[puerto->mensajes_salida & (BLOQUES_CANTIDAD - 1)];
+   }
+   return (mensaje);
+}
+
+uint32_t DatosPendientes(puerto_t * puerto) {
+   return (ColaOcupada(&puerto->cola) + ColaOcupada(&puerto->urgente));
+}
+
+uint32_t SiguienteTramo(puerto_t * puerto, const uint8_t ** datos) {
+   mensaje_t * mensaje;
+   uint32_t cantidad;
+   uint32_t distancia;
+
+   /* La politica de lotes es la misma que aplica el coprocesador */
+   cantidad = LoteTramo(&puerto->lote, datos);
+   if (!LOTE_URGENTE(&puerto->lote)) {
+      mensaje = MensajePendiente(puerto);
+      if ((mensaje != NULL) && (mensaje->posicion == puerto->cola.salida)) {
+         *datos = mensaje->datos + puerto->enviados_mensaje;
+         cantidad = mensaje->cantidad - puerto->enviados_mensaje;
+      } else if (mensaje != NULL) {
+         /* Los datos de la cola se envian solo hasta el próximo mensaje */
+         distancia = mensaje->posicion - puerto->cola.salida;
+         if (cantidad > distancia) {
+            cantidad = distancia;
+         }
+      }
+   }
+   return (cantidad);
+}
+
+void DescartarTramo(puerto_t * puerto, uint32_t cantidad) {
+   mensaje_t * mensaje = MensajePendiente(puerto);
+
+   ESTADISTICA_SUMAR(puerto, enviados, cantidad);
+
+   if (!LOTE_URGENTE(&puerto->lote) && (mensaje != NULL)
+      && (mensaje->posicion == puerto->cola.salida)) {
+      /* Del mensaje en bloque solo queda en la cola el byte que reserva su
+         lugar, que se retira cuando se termina de enviar */
+      puerto->enviados_mensaje += cantidad;
+      cantidad = 0;
+      if (puerto->enviados_mensaje >= mensaje->cantidad) {
+         /* Se libera el bloque y luego el byte que reservaba su lugar */
+         BloqueDevolver((void *) mensaje->datos);
+         puerto->enviados_mensaje = 0;
+         puerto->mensajes_salida++;
+         cantidad = 1;
+      }
+   }
+   LoteDescartar(&puerto->lote, cantidad);
+}
+
+#if SERIAL_DMA
+bool IniciarDma(puerto_t * puerto) {
+   const uint8_t * datos;
+   uint32_t cantidad;
+
+   cantidad = SiguienteTramo(puerto, &datos);
+   if (cantidad > DMA_TRANSFERENCIA_MAXIMA) {
+      cantidad = DMA_TRANSFERENCIA_MAXIMA;
+   }
+
+   if (cantidad >= SERIAL_DMA_UMBRAL) {
+      /* El tramo se transfiere desde la memoria de la cola o del mensaje,
+         que no se libera hasta la interrupción de fin de transferencia */
+      Chip_GPDMA_Transfer(LPC_GPDMA, puerto->canal_dma, (uint32_t) (uintptr_t) datos,
+         puerto->config->conexion_dma, GPDMA_TRANSFERTYPE_M2P_CONTROLLER_DMA, cantidad);
+      puerto->enviados_dma = cantidad;
+   }
+   return (puerto->enviados_dma != 0);
+}
+#endif
+
+void NotificarEsperas(puerto_t * puerto) {
+   uint8_t indice;
+   TaskType tarea;
+
+   for (indice = 0; indice < SERIAL_ESPERAS; indice++) {
+      tarea = puerto->esperas[indice].tarea;
+      if ((tarea != INVALID_TASK)
+         && ((int32_t)(puerto->cola.salida - puerto->esperas[indice].objetivo) >= 0)) {
+         SetEvent(tarea, Completo);
+      }
+   }
+
+   for (indice = 0; indice < SERIAL_AVISOS; indice++) {
+      if (puerto->avisos[indice].ocupado
+         && ((int32_t)(puerto->cola.salida - puerto->avisos[indice].objetivo) >= 0)) {
+         puerto->avisos[indice].ocupado = FALSE;
+         if (puerto->avisos[indice].funcion != NULL) {
+            puerto->avisos[indice].funcion(puerto->avisos[indice].parametro);
+         }
+         if (puerto->avisos[indice].tarea != INVALID_TASK) {
+            ActivateTask(puerto->avisos[indice].tarea);
+         }
+      }
+   }
+}
+
+bool ArmarTrama(puerto_t * puerto, uint8_t dato) {
+   bool completa = FALSE;
+   uint8_t longitud;
+
+#if SERIAL_RX_TRAMA == TRAMA_DELIMITADA
+   if (dato == puerto->config->delimitador) {
+      if ((puerto->armado > 0) && !puerto->descartando) {
+         longitud = puerto->armado;
+         ColaCopiar(&puerto->recepcion, 0, &longitud, 1);
+         ColaPublicar(&puerto->recepcion, puerto->armado + 1);
+         ESTADISTICA_MAXIMO(puerto, maximo_recepcion, ColaOcupada(&puerto->recepcion));
+         completa = TRUE;
+      }
+      puerto->armado = 0;
+      puerto->descartando = FALSE;
+   } else if (!puerto->descartando) {
+      if ((puerto->armado < SERIAL_RX_TRAMA_MAXIMA)
+         && ColaCopiar(&puerto->recepcion, puerto->armado + 1, &dato, 1)) {
+         puerto->armado++;
+      } else {
+         /* La trama no entra en la cola y se descarta completa */
+         puerto->descartando = TRUE;
+         ESTADISTICA_SUMAR(puerto, tramas_descartadas, 1);
+      }
+   }
+#else
+   if (puerto->faltantes == 0) {
+      /* El primer byte de la trama indica su longitud */
+      puerto->faltantes = dato;
+      puerto->armado = 0;
+      puerto->descartando = (dato > SERIAL_RX_TRAMA_MAXIMA)
+         || (ColaLibre(&puerto->recepcion) < (uint32_t) dato + 1);
+      ESTADISTICA_SUMAR(puerto, tramas_descartadas, puerto->descartando);
+   } else {
+      if (!puerto->descartando) {
+         ColaCopiar(&puerto->recepcion, puerto->armado + 1, &dato, 1);
+         puerto->armado++;
+      }
+      puerto->faltantes--;
+
+      if ((puerto->faltantes == 0) && !puerto->descartando) {
+         longitud = puerto->armado;
+         ColaCopiar(&puerto->recepcion, 0, &longitud, 1);
+         ColaPublicar(&puerto->recepcion, puerto->armado + 1);
+         ESTADISTICA_MAXIMO(puerto, maximo_recepcion, ColaOcupada(&puerto->recepcion));
+         completa = TRUE;
+      }
+   }
+#endif
+   return (completa);
+}
+
+bool RecibirCaracteres(puerto_t * puerto) {
+   uint32_t estado;
+   uint8_t dato;
+   bool trama = FALSE;
+
+   estado = Chip_UART_ReadLineStatus(puerto->config->uart);
+   while (estado & UART_LSR_RDR) {
+      dato = Chip_UART_ReadByte(puerto->config->uart);
+      if (ProcesarCaracter(puerto, estado, dato)) {
+         trama = TRUE;
+      }
+      estado = Chip_UART_ReadLineStatus(puerto->config->uart);
+   }
+   return (trama);
+}
+
+bool ProcesarCaracter(puerto_t * puerto, uint32_t estado, uint8_t dato) {
+   bool trama = FALSE;
+
+   ESTADISTICA_SUMAR(puerto, recibidos, 1);
+   /* La lectura del registro de estado borra los bits de error */
+   ESTADISTICA_SUMAR(puerto, desbordes, (estado & UART_LSR_OE) != 0);
+   ESTADISTICA_SUMAR(puerto, errores_paridad, (estado & UART_LSR_PE) != 0);
+   ESTADISTICA_SUMAR(puerto, errores_formato, (estado & UART_LSR_FE) != 0);
+   ESTADISTICA_SUMAR(puerto, cortes, (estado & UART_LSR_BI) != 0);
+   if (estado & UART_LSR_ERRORES) {
+#if SERIAL_RX_TRAMA == TRAMA_DELIMITADA
+      puerto->descartando = (dato != puerto->config->delimitador);
+      puerto->armado = 0;
+#else
+      /* Un error en el byte de longitud no se puede recuperar porque sin
+         delimitador no se sabe donde termina la trama */
+      if (puerto->faltantes > 0) {
+         puerto->descartando = TRUE;
+         ArmarTrama(puerto, dato);
+      }
+#endif
+#if SERIAL_XONXOFF
+   } else if (dato == SERIAL_XOFF) {
+      Chip_UART_TXDisable(puerto->config->uart);
+   } else if (dato == SERIAL_XON) {
+      Chip_UART_TXEnable(puerto->config->uart);
+#endif
+   } else if (ArmarTrama(puerto, dato)) {
+      trama = TRUE;
+   }
+   return (trama);
+}
+
+#if SERIAL_COPROCESADOR
+bool RecibirCoprocesador(puerto_t * puerto) {
+   uint8_t caracter[2];
+   uint32_t perdidos;
+   bool trama = FALSE;
+
+   /* El coprocesador publica el estado y el dato de cada caracter juntos */
+   while (ColaLeer(&recepcion_coprocesador, caracter, sizeof(caracter)) == sizeof(caracter)) {
+      if (ProcesarCaracter(puerto, caracter[0], caracter[1])) {
+         trama = TRUE;
+      }
+   }
+   perdidos = BUZON->perdidos;
+   ESTADISTICA_SUMAR(puerto, desbordes, perdidos - perdidos_coprocesador);
+   perdidos_coprocesador = perdidos;
+   return (trama);
+}
+
+void ArrancarCoprocesador(void) {
+   puerto_t * consola = &puertos[PUERTO_CONSOLA];
+   buzon_t * buzon = BUZON;
+
+   /* El M0 queda en reset mientras se completa el descriptor */
+   Chip_RGU_TriggerReset(RGU_M0APP_RST);
+   NVIC_DisableIRQ(consola->config->interrupcion);
+   NVIC_ClearPendingIRQ(consola->config->interrupcion);
+
+   ColaIniciar(&recepcion_coprocesador, buffer_coprocesador, sizeof(buffer_coprocesador));
+   buzon->uart = consola->config->uart;
+   buzon->lote = &consola->lote;
+   buzon->recepcion = &recepcion_coprocesador;
+   buzon->perdidos = 0;
+   perdidos_coprocesador = 0;
+   __DMB();
+   buzon->firma = BUZON_FIRMA;
+   __DSB();
+
+   Chip_Clock_Enable(CLK_M4_M0APP);
+   Chip_CREG_SetM0AppMemMap(SERIAL_COPROCESADOR_IMAGEN);
+   Chip_RGU_ClearReset(RGU_M0APP_RST);
+}
+#endif
+
+uint32_t RecibirTrama(puerto_t * puerto, uint8_t * datos, uint32_t maximo) {
+   const uint8_t * bloque;
+   uint8_t longitud;
+   uint32_t copiados = 0;
+
+   if (ColaLeer(&puerto->recepcion, &longitud, 1)) {
+      copiados = ColaLeer(&puerto->recepcion, datos,
+         (longitud < maximo) ? longitud : maximo);
+
+      /* Se descarta la parte de la trama que no entra en el destino */
+      longitud -= copiados;
+      while (longitud > 0) {
+         maximo = ColaBloque(&puerto->recepcion, &bloque);
+         if (maximo > longitud) {
+            maximo = longitud;
+         }
+         ColaDescartar(&puerto->recepcion, maximo);
+         longitud -= maximo;
+      }
+   }
+   return (copiados);
+}
+
+bool EnviarCaracter(puerto_t * puerto) {
+   bool completo = FALSE;
+
+#if SERIAL_MEDICION
+   /* Solo se mide la demora de los mensajes que encuentran la cola vacia,
+      los demas esperan ademas la salida de los mensajes anteriores */
+   if (puerto->primer_byte_pendiente && ColaOcupada(&puerto->cola)) {
+      puerto->primer_byte_pendiente = FALSE;
+      MEDICION_REGISTRAR(&demora_primer_byte, puerto->marca_encolado);
+   }
+#endif
+
+#if SERIAL_DMA
+   if (puerto->enviados_dma || IniciarDma(puerto)) {
+      /* Mientras transmite el DMA no se atiende la interrupción de la uart */
+      Chip_UART_IntDisable(puerto->config->uart, UART_IER_THREINT);
+   } else
+#endif
+   if (Chip_UART_ReadLineStatus(puerto->config->uart) & UART_LSR_THRE) {
+      LlenarFifo(puerto);
+      completo = TRUE;
+
+      if (DatosPendientes(puerto) == 0) {
+         Chip_UART_IntDisable(puerto->config->uart, UART_IER_THREINT);
+      }
+   }
+   return (completo);
+}
+
+#if TECLADO_INTERRUPCION
+void ConfigurarTeclas(void) {
+   uint8_t canal;
+
+   for (canal = 0; canal < TECLAS_CANTIDAD; canal++) {
+      Chip_SCU_GPIOIntPinSel(canal, teclas[canal].puerto, teclas[canal].pin);
+      Chip_PININT_ClearIntStatus(LPC_GPIO_PIN_INT, PININTCH(canal));
+      Chip_PININT_SetPinModeEdge(LPC_GPIO_PIN_INT, PININTCH(canal));
+      Chip_PININT_EnableIntLow(LPC_GPIO_PIN_INT, PININTCH(canal));
+      Chip_PININT_EnableIntHigh(LPC_GPIO_PIN_INT, PININTCH(canal));
+   }
+}
+
+void AtenderTecla(uint8_t canal) {
+   Chip_PININT_ClearIntStatus(LPC_GPIO_PIN_INT, PININTCH(canal));
+
+   /* Las rutinas de las teclas tienen la misma prioridad, por lo que no se
+      pueden interrumpir entre ellas al revisar la bandera */
+   if (!antirrebote) {
+      antirrebote = TRUE;
+      SetRelAlarm(Antirrebote, TECLADO_ANTIRREBOTE, 0);
+   }
+}
+#endif
+
+bool EsComando(const uint8_t * trama, uint32_t cantidad, const char * nombre) {
+   uint32_t longitud = strlen(nombre);
+
+   if ((cantidad == longitud + 1) && (trama[longitud] == '\r')) {
+      cantidad = longitud;
+   }
+   return ((cantidad == longitud) && (memcmp(trama, nombre, longitud) == 0));
+}
+
+bool EsComandoNumero(const uint8_t * trama, uint32_t cantidad, const char * nombre,
+   uint32_t * argumento) {
+   uint32_t longitud = strlen(nombre);
+   uint32_t valor = 0;
+   bool valido;
+
+   if ((cantidad > 0) && (trama[cantidad - 1] == '\r')) {
+      cantidad--;
+   }
+   valido = (cantidad > longitud + 1) && (memcmp(trama, nombre, longitud) == 0)
+      && (trama[longitud] == ' ');
+   for (longitud++; valido && (longitud < cantidad); longitud++) {
+      valido = (trama[longitud] >= '0') && (trama[longitud] <= '9')
+         && (valor <= (UINT32_MAX - 9) / 10);
+      valor = valor * 10 + (trama[longitud] - '0');
+   }
+   if (valido) {
+      *argumento = valor;
+   }
+   return (valido);
+}
+
+bool EjecutarComando(const uint8_t * trama, uint32_t cantidad) {
+   puerto_t * consola = &puertos[PUERTO_CONSOLA];
+   divisor_t divisor;
+   uint32_t baudios;
+   uint32_t disparo;
+   disparo_t nivel = DISPARO_1_BYTE;
+   bool ejecutado = FALSE;
+
+   if (EsComandoNumero(trama, cantidad, "baudios", &baudios)) {
+      /* La respuesta sale a la velocidad anterior, de modo que el otro
+         extremo cambia la suya cuando la recibe completa */
+      if (UART_PROPIA(PUERTO_CONSOLA)
+         && DivisorCalcular(Chip_Clock_GetRate(consola->config->reloj), baudios, &divisor)) {
+         EnviarFormato("Baudios %u\r\n", baudios);
+         CambiarBaudios(PUERTO_CONSOLA, baudios);
+      } else {
+         EnviarFormato("Baudios %u no disponible\r\n", baudios);
+      }
+      ejecutado = TRUE;
+   }
+
+   if (EsComandoNumero(trama, cantidad, "disparo", &disparo)) {
+      /* Se indica la cantidad de bytes del nivel o cero para el adaptativo */
+      while ((nivel < DISPARO_ADAPTATIVO) && (bytes_disparo[nivel] != disparo)) {
+         nivel++;
+      }
+      if ((disparo == 0) && CambiarDisparo(PUERTO_CONSOLA, DISPARO_ADAPTATIVO)) {
+         EnviarFormato("Disparo adaptativo\r\n");
+      } else if ((nivel < DISPARO_ADAPTATIVO) && CambiarDisparo(PUERTO_CONSOLA, nivel)) {
+         EnviarFormato("Disparo %u\r\n", disparo);
+      } else {
+         EnviarFormato("Disparo %u no disponible\r\n", disparo);
+      }
+      ejecutado = TRUE;
+   }
+
+#if SERIAL_ESTADISTICAS
+   if (EsComando(trama, cantidad, "estadisticas")) {
+      InformarEstadisticas();
+      ejecutado = TRUE;
+   }
+#endif
+
+#if SERIAL_PILAS
+   if (EsComando(trama, cantidad, "pilas")) {
+      InformarPilas();
+      ejecutado = TRUE;
+   }
+#endif
+   return (ejecutado);
+}
+
+#if SERIAL_PILAS
+void InformarPilas(void) {
+   TaskType tarea;
+
+   for (tarea = 0; tarea < sizeof(nombres_tareas) / sizeof(nombres_tareas[0]); tarea++) {
+      /* Cada linea se espera si no entra en la cola, no se pierde ninguna */
+      while (!EnviarFormato("Pila de %s: %u de %u bytes\r\n", nombres_tareas[tarea],
+         PilaUsada(tarea), PilaTamanio(tarea))) {
+         EsperarTransmision();
+      }
+   }
+}
+#endif
+
+#if SERIAL_MEDICION
+void InformarMediciones(void) {
+   static const char * const nombres[] = {
+      "Interrupcion", "Primer byte", "Completo",
+   };
+   medicion_t mediciones[3];
+   uint8_t indice;
+
+   /* Las mediciones de las rutinas de servicio se copian sin interrupciones
+      para no mezclar campos de dos registros distintos */
+   SuspendOSInterrupts();
+   mediciones[0] = duracion_interrupcion;
+   mediciones[1] = demora_primer_byte;
+   ResumeOSInterrupts();
+   GetResource(RecursoSerial);
+   mediciones[2] = demora_completo;
+   ReleaseResource(RecursoSerial);
+
+   for (indice = 0; indice < 3; indice++) {
+      EnviarFormato("%s: %u / %u / %u ciclos en %u mediciones\r\n",
+         nombres[indice], mediciones[indice].minimo,
+         MedicionPromedio(&mediciones[indice]), mediciones[indice].maximo,
+         mediciones[indice].cuenta);
+   }
+}
+#endif
+
+#if SERIAL_ESTADISTICAS
+void InformarEstadisticas(void) {
+   estadisticas_t estadisticas;
+   uint8_t indice;
+
+   for (indice = 0; indice < PUERTOS_CANTIDAD; indice++) {
+      LeerEstadisticas(indice, &estadisticas);
+      while (!EnviarFormato("%s: %u enviados, %u recibidos, %u interrupciones\r\n",
+         puertos[indice].config->nombre, estadisticas.enviados, estadisticas.recibidos,
+         estadisticas.interrupciones)) {
+         EsperarTransmision();
+      }
+      while (!EnviarFormato("  Errores: %u desbordes, %u paridad, %u formato, %u cortes,"
+         " %u tramas descartadas\r\n", estadisticas.desbordes, estadisticas.errores_paridad,
+         estadisticas.errores_formato, estadisticas.cortes, estadisticas.tramas_descartadas)) {
+         EsperarTransmision();
+      }
+      while (!EnviarFormato("  Colas: %u de %u recepcion, %u de %u transmision, %u rechazados,"
+         " %u esperas en %u us\r\n", estadisticas.maximo_recepcion, SERIAL_RX_LONGITUD,
+         estadisticas.maximo_transmision, SERIAL_TX_LONGITUD, estadisticas.rechazados,
+         estadisticas.esperas, estadisticas.tiempo_espera)) {
+         EsperarTransmision();
+      }
+   }
+}
+#endif
+
+void ApagarIndicador(void * parametro) {
+   (void) parametro;
+
+   Led_Off(YELLOW_LED);
+}
+
+void ReintentarEnvio(void * parametro) {
+   (void) parametro;
+
+   reintento_envio = FALSE;
+}
+
+#if SERIAL_RS485
+void IniciarRs485(void) {
+   Chip_UART_Init(LPC_USART0);
+   Chip_UART_ConfigData(LPC_USART0, UART_LCR_WLEN8 | UART_LCR_SBS_1BIT | UART_LCR_PARITY_DIS);
+
+   /* La uart maneja la dirección del transceptor mientras transmite */
+   Chip_UART_SetRS485Flags(LPC_USART0, UART_RS485CTRL_DCTRL_EN | UART_RS485CTRL_OINV_1);
+   Chip_UART_TXEnable(LPC_USART0);
+
+   Chip_SCU_PinMux(9, 5, MD_PDN, FUNC7);                       /* P9_5: U0_TXD */
+   Chip_SCU_PinMux(9, 6, MD_PLN | MD_EZI | MD_ZI, FUNC7);      /* P9_6: U0_RXD */
+   Chip_SCU_PinMux(6, 2, MD_PDN, FUNC2);                       /* P6_2: U0_DIR */
+}
+#endif
+
+#if SERIAL_RS232
+void IniciarRs232(void) {
+   Chip_UART_Init(LPC_USART3);
+   Chip_UART_ConfigData(LPC_USART3, UART_LCR_WLEN8 | UART_LCR_SBS_1BIT | UART_LCR_PARITY_DIS);
+   Chip_UART_TXEnable(LPC_USART3);
+
+   Chip_SCU_PinMux(2, 3, MD_PDN, FUNC2);                       /* P2_3: U3_TXD */
+   Chip_SCU_PinMux(2, 4, MD_PLN | MD_EZI | MD_ZI, FUNC2);      /* P2_4: U3_RXD */
+}
+#endif
+
+void ConfigurarPuerto(puerto_t * puerto) {
+   divisor_t divisor;
+   uint8_t indice;
+
+   ColaIniciar(&puerto->cola, puerto->buffer_tx, sizeof(puerto->buffer_tx));
+   ColaIniciar(&puerto->urgente, puerto->buffer_urgente, sizeof(puerto->buffer_urgente));
+   ColaIniciar(&puerto->recepcion, puerto->buffer_rx, sizeof(puerto->buffer_rx));
+#if SERIAL_URGENTE_LIMITES
+   LoteIniciar(&puerto->lote, &puerto->cola, &puerto->urgente,
+      puerto->limites, SERIAL_URGENTE_LIMITES);
+#else
+   LoteIniciar(&puerto->lote, &puerto->cola, &puerto->urgente, NULL, 0);
+#endif
+   for (indice = 0; indice < SERIAL_ESPERAS; indice++) {
+      puerto->esperas[indice].tarea = INVALID_TASK;
+   }
+   puerto->config->iniciar();
+   puerto->baudios = puerto->config->baudios;
+   puerto->politica = puerto->config->disparo;
+   puerto->nivel = (puerto->politica == DISPARO_ADAPTATIVO) ? DISPARO_1_BYTE : puerto->politica;
+   if (DivisorCalcular(Chip_Clock_GetRate(puerto->config->reloj), puerto->baudios, &divisor)) {
+      AplicarDivisor(puerto, &divisor);
+   }
+
+   /* Habilitación y vaciado de las FIFOs de la uart, la interrupción de
+      recepción se genera con el nivel de disparo del puerto o por tiempo
+      entre caracteres */
+   Chip_UART_SetupFIFOS(puerto->config->uart, FCR_MODO | UART_FCR_TX_RS
+      | UART_FCR_RX_RS | niveles_disparo[puerto->nivel]);
+#if SERIAL_DMA
+   /* Reserva del canal de DMA para la transmisión */
+   puerto->canal_dma = Chip_GPDMA_GetFreeChannel(LPC_GPDMA, puerto->config->conexion_dma);
+#endif
+}
+
+void AplicarDivisor(puerto_t * puerto, const divisor_t * divisor) {
+   SuspendOSInterrupts();
+   Chip_UART_EnableDivisorAccess(puerto->config->uart);
+   Chip_UART_SetDivisorLatches(puerto->config->uart, divisor->latch & 0xFF, divisor->latch >> 8);
+   Chip_UART_DisableDivisorAccess(puerto->config->uart);
+   puerto->config->uart->FDR = UART_FDR_MULVAL(divisor->multiplicador)
+      | UART_FDR_DIVADDVAL(divisor->suma);
+   ResumeOSInterrupts();
+}
+
+void AplicarDisparo(puerto_t * puerto, disparo_t nivel) {
+   /* Sin los bits de vaciado la escritura solo cambia el nivel */
+   puerto->nivel = nivel;
+   Chip_UART_SetupFIFOS(puerto->config->uart, FCR_MODO | niveles_disparo[nivel]);
+}
+
+void AdaptarDisparo(puerto_t * puerto, uint32_t identificacion) {
+   disparo_t nivel = puerto->nivel;
+
+   identificacion &= UART_IIR_INTID_MASK;
+   if ((identificacion == UART_IIR_INTID_RDA) && (nivel < DISPARO_14_BYTES)) {
+      nivel++;
+   } else if (identificacion == UART_IIR_INTID_CTI) {
+      nivel = DISPARO_1_BYTE;
+   }
+   if (nivel != puerto->nivel) {
+      AplicarDisparo(puerto, nivel);
+   }
+}
+
+void IniciarTransmision(puerto_t * puerto) {
+#if SERIAL_COPROCESADOR
+   if (puerto == &puertos[PUERTO_CONSOLA]) {
+      /* Los datos publicados quedan visibles antes del aviso al M0 */
+      __DSB();
+      __SEV();
+   } else
+#endif
+   {
+      Chip_UART_IntEnable(puerto->config->uart, UART_IER_THREINT);
+      NVIC_SetPendingIRQ(puerto->config->interrupcion);
+   }
+}
+
+#if SERIAL_AGRUPAR_VENTANA
+bool AgruparTransmision(puerto_t * puerto) {
+   bool agrupar;
+
+   /* Si la rutina de servicio esta transmitiendo toma sola los datos nuevos,
+      que ya se publicaron, por lo que no puede terminar sin verlos */
+   agrupar = (ColaOcupada(&puerto->cola) < SERIAL_AGRUPAR_UMBRAL)
+      && ((Chip_UART_GetIntsEnabled(puerto->config->uart) & UART_IER_THREINT) == 0);
+#if SERIAL_DMA
+   agrupar = agrupar && (puerto->enviados_dma == 0);
+#endif
+   if (agrupar) {
+      puerto->agrupando = TRUE;
+      if (!ventana_activa) {
+         ventana_activa = TRUE;
+         SetRelAlarm(Agrupar, SERIAL_AGRUPAR_VENTANA, 0);
+      }
+   }
+   return (agrupar);
+}
+#endif
+
+void AtenderPuerto(puerto_t * puerto) {
+   MEDICION_INICIO(inicio);
+   TRAZA_INICIO(entrada);
+
+   ESTADISTICA_SUMAR(puerto, interrupciones, 1);
+   /* La lectura del registro de identificación borra la interrupción de
+      transmisión pendiente, que no se usa porque la transmisión se decide
+      con el registro de estado de la linea */
+   if (puerto->politica == DISPARO_ADAPTATIVO) {
+      AdaptarDisparo(puerto, Chip_UART_ReadIntIDReg(puerto->config->uart));
+   }
+   if (RecibirCaracteres(puerto)) {
+      SetEvent(puerto->config->tarea, puerto->config->evento);
+   }
+   if (EnviarCaracter(puerto)) {
+      NotificarEsperas(puerto);
+   }
+   /* Las rutinas de todos los puertos tienen la misma prioridad y comparten
+      la medición */
+   MEDICION_REGISTRAR(&duracion_interrupcion, inicio);
+   TRAZA_INTERRUPCION_FIN(puerto->config->traza, entrada);
+}
+
+void EsperarObjetivo(puerto_t * puerto, uint32_t objetivo) {
+   espera_t * espera = NULL;
+   uint8_t indice;
+   MEDICION_INICIO(inicio);
+#if SERIAL_ESTADISTICAS
+   uint32_t bloqueo = MedicionMarca();
+#endif
+
+   /* El registro en la tabla se hace con el recurso tomado para que no se
+      asigne el mismo lugar a dos tareas */
+   GetResource(RecursoSerial);
+   for (indice = 0; indice < SERIAL_ESPERAS; indice++) {
+      if (puerto->esperas[indice].tarea == INVALID_TASK) {
+         espera = &puerto->esperas[indice];
+         espera->objetivo = objetivo;
+         __DMB();
+         GetTaskID((TaskType *) &espera->tarea);
+         break;
+      }
+   }
+   ReleaseResource(RecursoSerial);
+
+   while ((int32_t)(puerto->cola.salida - objetivo) < 0) {
+      if (espera == NULL) {
+         /* Sin lugar en la tabla ninguna rutina envia el evento, por lo que
+            la tarea consulta la cola y cede el procesador entre consultas */
+         Schedule();
+      } else {
+         ClearEvent(Completo);
+         /* Se verifica otra vez por si los datos salieron antes de borrar el
+            evento, en ese caso la notificación ya se perdió */
+         if ((int32_t)(puerto->cola.salida - objetivo) < 0) {
+            WaitEvent(Completo);
+         }
+      }
+   }
+
+   if (espera != NULL) {
+      espera->tarea = INVALID_TASK;
+   }
+
+#if SERIAL_MEDICION
+   /* Varias tareas pueden esperar la transmisión y comparten la medición */
+   GetResource(RecursoSerial);
+   MEDICION_REGISTRAR(&demora_completo, inicio);
+   ReleaseResource(RecursoSerial);
+#endif
+#if SERIAL_ESTADISTICAS
+   GetResource(RecursoSerial);
+   ESTADISTICA_SUMAR(puerto, esperas, 1);
+   ESTADISTICA_SUMAR(puerto, tiempo_espera,
+      (MedicionMarca() - bloqueo) / (SystemCoreClock / 1000000));
+   ReleaseResource(RecursoSerial);
+#endif
+}
+
+/* === Definiciones de funciones externas ================================== */
+
+bool ReservarPuerto(puerto_serial_t numero, uint32_t cantidad) {
+   puerto_t * puerto = &puertos[numero];
+   bool resultado = FALSE;
+
+   GetResource(RecursoSerial);
+   if (ColaLibre(&puerto->cola) >= cantidad) {
+      reservado = puerto;
+      reservados = ColaLibre(&puerto->cola);
+      escritos = 0;
+      resultado = TRUE;
+   } else {
+      ESTADISTICA_SUMAR(puerto, rechazados, 1);
+      ReleaseResource(RecursoSerial);
+   }
+   return (resultado);
+}
+
+bool ReservarEspacio(uint32_t cantidad) {
+   return (ReservarPuerto(PUERTO_CONSOLA, cantidad));
+}
+
+bool EscribirReserva(const void * datos, uint32_t cantidad) {
+   uint32_t copiados = cantidad;
+
+   if (copiados > reservados - escritos) {
+      copiados = reservados - escritos;
+   }
+   copiados = ColaCopiar(&reservado->cola, escritos, datos, copiados);
+   escritos += copiados;
+   return (copiados == cantidad);
+}
+
+bool EscribirTexto(const char * cadena) {
+   uint32_t copiados;
+
+   copiados = ColaCopiarTexto(&reservado->cola, escritos, cadena);
+   escritos += copiados;
+   return (cadena[copiados] == '\0');
+}
+
+uint32_t EscritosReserva(void) {
+   return (escritos);
+}
+
+bool CorregirReserva(uint32_t posicion, const void * datos, uint32_t cantidad) {
+   bool corregido = (posicion <= escritos) && (cantidad <= escritos - posicion);
+
+   if (corregido) {
+      ColaCopiar(&reservado->cola, posicion, datos, cantidad);
+   }
+   return (corregido);
+}
+
+void CancelarReserva(void) {
+   ReleaseResource(RecursoSerial);
+}
+
+void ConfirmarReserva(void) {
+   puerto_t * puerto = reservado;
+   bool iniciar = TRUE;
+
+#if SERIAL_MEDICION
+   if ((ColaOcupada(&puerto->cola) == 0) && (escritos > 0)) {
+      puerto->marca_encolado = MedicionMarca();
+      __DMB();
+      puerto->primer_byte_pendiente = TRUE;
+   }
+#endif
+   /* El limite se registra antes de publicar los datos para que la rutina
+      de servicio no lo pueda pasar */
+   if (escritos > 0) {
+      LoteRegistrar(&puerto->lote, puerto->cola.entrada + escritos);
+   }
+   ColaPublicar(&puerto->cola, escritos);
+   ESTADISTICA_MAXIMO(puerto, maximo_transmision, ColaOcupada(&puerto->cola));
+#if SERIAL_AGRUPAR_VENTANA
+   iniciar = !AgruparTransmision(puerto);
+#endif
+   ReleaseResource(RecursoSerial);
+
+   if (iniciar) {
+      IniciarTransmision(puerto);
+   }
+}
+
+bool EnviarPuerto(puerto_serial_t numero, const void * datos, uint32_t cantidad) {
+   bool encolado = FALSE;
+
+   if (ReservarPuerto(numero, cantidad)) {
+      EscribirReserva(datos, cantidad);
+      ConfirmarReserva();
+      encolado = TRUE;
+   }
+   return (encolado);
+}
+
+bool EnviarBloque(const void * datos, uint32_t cantidad) {
+   return (EnviarPuerto(PUERTO_CONSOLA, datos, cantidad));
+}
+
+bool EnviarFragmentos(const fragmento_t * fragmentos, uint8_t cantidad) {
+   uint32_t total = 0;
+   uint8_t indice;
+   bool encolado = FALSE;
+
+   for (indice = 0; indice < cantidad; indice++) {
+      total += fragmentos[indice].cantidad;
+   }
+
+   if (ReservarEspacio(total)) {
+      for (indice = 0; indice < cantidad; indice++) {
+         EscribirReserva(fragmentos[indice].datos, fragmentos[indice].cantidad);
+      }
+      ConfirmarReserva();
+      encolado = TRUE;
+   }
+   return (encolado);
+}
+
+bool EnviarTexto(const char * cadena) {
+   bool encolada = FALSE;
+
+   if (ReservarEspacio(0)) {
+      /* Si la cadena no entra en la cola no se publica ningun caracter */
+      if (EscribirTexto(cadena)) {
+         ConfirmarReserva();
+         encolada = TRUE;
+      } else {
+         CancelarReserva();
+      }
+   }
+   return (encolada);
+}
+
+void EnviarDatos(const void * datos, uint32_t cantidad) {
+   puerto_t * puerto = &puertos[PUERTO_CONSOLA];
+   const uint8_t * origen = datos;
+   uint32_t parcial;
+
+   while (cantidad > 0) {
+      parcial = ColaLibre(&puerto->cola);
+      if (parcial > cantidad) {
+         parcial = cantidad;
+      }
+
+      /* Para no transmitir en partes muy chicas se espera hasta que se
+         libere la mitad de la cola o lugar para todo el resto del bloque */
+      if (((parcial == cantidad) || (parcial >= SERIAL_TX_LONGITUD / 2))
+         && ReservarEspacio(parcial)) {
+         EscribirReserva(origen, parcial);
+         ConfirmarReserva();
+         origen += parcial;
+         cantidad -= parcial;
+      } else {
+         EsperarObjetivo(puerto, puerto->cola.entrada - SERIAL_TX_LONGITUD / 2);
+      }
+   }
+}
+
+bool EnviarUrgente(const void * datos, uint32_t cantidad) {
+   puerto_t * puerto = &puertos[PUERTO_CONSOLA];
+   bool encolado = FALSE;
+
+   GetResource(RecursoSerial);
+   if (ColaLibre(&puerto->urgente) >= cantidad) {
+      ColaEscribir(&puerto->urgente, datos, cantidad);
+      encolado = TRUE;
+   } else {
+      ESTADISTICA_SUMAR(puerto, rechazados, 1);
+   }
+   ReleaseResource(RecursoSerial);
+
+   if (encolado) {
+      IniciarTransmision(puerto);
+   }
+   return (encolado);
+}
+
+void * PedirMensaje(void) {
+   void * mensaje;
+
+   GetResource(RecursoSerial);
+   mensaje = BloquePedir();
+   ReleaseResource(RecursoSerial);
+   return (mensaje);
+}
+
+bool EntregarMensaje(void * mensaje, uint32_t cantidad) {
+#if !SERIAL_COPROCESADOR
+   puerto_t * puerto = &puertos[PUERTO_CONSOLA];
+   mensaje_t * descriptor;
+#endif
+   bool entregado = TRUE;
+
+   if (cantidad > BLOQUES_TAMANIO) {
+      cantidad = BLOQUES_TAMANIO;
+   }
+
+   if (cantidad == 0) {
+      LiberarMensaje(mensaje);
+#if SERIAL_COPROCESADOR
+   } else if (ReservarEspacio(cantidad)) {
+      /* El coprocesador solo transmite las colas, por lo que el mensaje se
+         copia y el bloque se libera enseguida */
+      EscribirReserva(mensaje, cantidad);
+      ConfirmarReserva();
+      LiberarMensaje(mensaje);
+#else
+   } else if (ReservarEspacio(1)) {
+      /* El descriptor apunta al byte de la cola que reserva su lugar */
+      descriptor = &puerto->mensajes[puerto->mensajes_entrada & (BLOQUES_CANTIDAD - 1)];
+      descriptor->posicion = puerto->cola.entrada;
+      descriptor->datos = mensaje;
+      descriptor->cantidad = cantidad;
+      EscribirReserva("", 1);
+      __DMB();
+      puerto->mensajes_entrada++;
+      ConfirmarReserva();
+#endif
+   } else {
+      entregado = FALSE;
+   }
+   return (entregado);
+}
+
+void LiberarMensaje(void * mensaje) {
+   /* La rutina de servicio tambien devuelve bloques a la reserva */
+   SuspendOSInterrupts();
+   BloqueDevolver(mensaje);
+   ResumeOSInterrupts();
+}
+
+bool AvisarPuerto(puerto_serial_t numero, TaskType tarea, completo_t funcion, void * parametro) {
+   puerto_t * puerto = &puertos[numero];
+   aviso_t * aviso = NULL;
+   uint8_t indice;
+
+   GetResource(RecursoSerial);
+   for (indice = 0; indice < SERIAL_AVISOS; indice++) {
+      if (!puerto->avisos[indice].ocupado) {
+         aviso = &puerto->avisos[indice];
+         aviso->objetivo = puerto->cola.entrada;
+         aviso->tarea = tarea;
+         aviso->funcion = funcion;
+         aviso->parametro = parametro;
+         __DMB();
+         aviso->ocupado = TRUE;
+         break;
+      }
+   }
+   ReleaseResource(RecursoSerial);
+
+   if (aviso != NULL) {
+      /* Si la cola ya esta vacia la interrupción de la FIFO vacia da el
+         aviso, sin esperar nuevos datos. El coprocesador responde siempre
+         al pedido para que el M4 revise los avisos */
+      IniciarTransmision(puerto);
+   }
+   return (aviso != NULL);
+}
+
+bool AvisarTransmision(TaskType tarea, completo_t funcion, void * parametro) {
+   return (AvisarPuerto(PUERTO_CONSOLA, tarea, funcion, parametro));
+}
+
+void EsperarSalida(uint32_t objetivo) {
+   EsperarObjetivo(&puertos[PUERTO_CONSOLA], objetivo);
+}
+
+void EsperarPuerto(puerto_serial_t numero) {
+   EsperarObjetivo(&puertos[numero], puertos[numero].cola.entrada);
+}
+
+void EsperarTransmision(void) {
+   EsperarPuerto(PUERTO_CONSOLA);
+}
+
+bool CambiarBaudios(puerto_serial_t numero, uint32_t baudios) {
+   puerto_t * puerto = &puertos[numero];
+   divisor_t divisor;
+   bool cambiado = FALSE;
+
+   if (UART_PROPIA(numero)
+      && DivisorCalcular(Chip_Clock_GetRate(puerto->config->reloj), baudios, &divisor)) {
+      /* Los datos ya encolados salen a la velocidad anterior y el recurso
+         impide que otras tareas encolen mas mientras se cambia */
+      GetResource(RecursoSerial);
+      while (DatosPendientes(puerto) > 0) {
+         ReleaseResource(RecursoSerial);
+         EsperarPuerto(numero);
+         GetResource(RecursoSerial);
+      }
+
+      /* La cola vacia no implica que la uart termino, la FIFO y el registro
+         de desplazamiento pueden tener hasta 17 caracteres */
+      while ((Chip_UART_ReadLineStatus(puerto->config->uart) & UART_LSR_TEMT) == 0) {
+      }
+      AplicarDivisor(puerto, &divisor);
+      puerto->baudios = baudios;
+      ReleaseResource(RecursoSerial);
+      cambiado = TRUE;
+   }
+   return (cambiado);
+}
+
+bool CambiarDisparo(puerto_serial_t numero, disparo_t disparo) {
+   puerto_t * puerto = &puertos[numero];
+   bool cambiado = FALSE;
+
+   if (UART_PROPIA(numero) && (disparo <= DISPARO_ADAPTATIVO)) {
+      /* La rutina de servicio tambien cambia el nivel en el modo adaptativo */
+      SuspendOSInterrupts();
+      puerto->politica = disparo;
+      AplicarDisparo(puerto, (disparo == DISPARO_ADAPTATIVO) ? DISPARO_1_BYTE : disparo);
+      ResumeOSInterrupts();
+      cambiado = TRUE;
+   }
+   return (cambiado);
+}
+
+#if SERIAL_ESTADISTICAS
+void LeerEstadisticas(puerto_serial_t numero, estadisticas_t * estadisticas) {
+   *estadisticas = puertos[numero].estadisticas;
+}
+#endif
+
+void DespacharPuerto(puerto_serial_t numero) {
+   IniciarTransmision(&puertos[numero]);
+}
+
+void DespacharTransmision(void) {
+   DespacharPuerto(PUERTO_CONSOLA);
+}
+
+uint32_t BaudiosPuerto(puerto_serial_t numero) {
+   return (puertos[numero].baudios);
+}
+
+uint32_t RecibirPuerto(puerto_serial_t numero, uint8_t * datos, uint32_t maximo) {
+   return (RecibirTrama(&puertos[numero], datos, maximo));
+}
+
+/** @brief Tarea de configuración
+ **
+ ** Esta tarea arranca automaticamente en el modo de aplicacion Normal.
+ */
+TASK(Configuracion) {
+
+   uint8_t indice;
+
+   /* Inicializaciones y configuraciones de dispositivos */
+   BloquesIniciar();
+   PaquetesIniciar();
+#if SERIAL_MEDICION
+   MedicionIniciar();
+#endif
+#if SERIAL_TRAZA
+   TrazaIniciar();
+#endif
+#if SERIAL_BITACORA
+   BitacoraIniciar();
+#endif
+   TiempoIniciar();
+   Init_Leds();
+   Init_Switches();
+#if SERIAL_DMA
+   Chip_GPDMA_Init(LPC_GPDMA);
+#endif
+   for (indice = 0; indice < PUERTOS_CANTIDAD; indice++) {
+      ConfigurarPuerto(&puertos[indice]);
+   }
+
+   /* La tarea que procesa las tramas debe estar activa antes de recibirlas */
+   ActivateTask(Recepcion);
+   for (indice = 0; indice < PUERTOS_CANTIDAD; indice++) {
+      Chip_UART_IntEnable(puertos[indice].config->uart, UART_IER_RBRINT | UART_IER_RLSINT);
+   }
+#if SERIAL_COPROCESADOR
+   ArrancarCoprocesador();
+#endif
+
+#if TECLADO_INTERRUPCION
+   /* La tarea Teclado solo se activa cuando cambia alguna tecla */
+   ConfigurarTeclas();
+#else
+   /* Arranque de la alarma para la activación periorica de la tarea Baliza */
+   SetRelAlarm(RevisarTeclado, 250, 100);
+#endif
+
+   /* La tarea ociosa queda lista para cuando no hay otras tareas listas */
+   ChainTask(Ocioso);
+}
+
+/** @brief Tarea que escanea el teclado
+ **
+ ** Esta tarea se activa cada vez que expira la alarma RevisarTeclado, o la
+ ** alarma Antirrebote con @ref TECLADO_INTERRUPCION, lee el estado actual de
+ ** la teclas y lo compara con el de la ultima activacion para detectar los
+ ** cambios en las teclas y generar eventos al detectar la pulsación de una
+ ** tecla.
+ */
+TASK(Teclado) {
+   static uint8_t anterior = 0;
+   static uint32_t pulsaciones = 0;
+   uint8_t tecla;
+
+#if TECLADO_INTERRUPCION
+   /* Se baja la bandera antes de leer para que un flanco posterior a la
+      lectura arranque otra vez la alarma */
+   antirrebote = FALSE;
+#endif
+   tecla = Read_Switches();
+   if (tecla != anterior) {
+      switch(tecla) {
+      case TEC1:
+         ActivateTask(Enviar);
+         break;
+      case TEC2:
+         /* El aviso no espera a los datos normales y si la cola de avisos
+            esta llena se descarta */
+         EnviarUrgente(LITERAL("Tecla 2\r\n"));
+         break;
+      case TEC3:
+         pulsaciones++;
+         BITACORA("Tecla 3: %u pulsaciones\r\n", pulsaciones);
+         break;
+      case TEC4:
+#if SERIAL_MEDICION
+         InformarMediciones();
+#else
+         /* La tarea no espera la transmisión, el led se apaga con un aviso */
+         Led_On(YELLOW_LED);
+         if (!EnviarBloque(LITERAL("Tecla 4\r\n"))
+            || !AvisarTransmision(INVALID_TASK, ApagarIndicador, NULL)) {
+            Led_Off(YELLOW_LED);
+         }
+#endif
+         break;
+      }
+      anterior = tecla;
+   }
+   Led_Toggle(GREEN_LED);
+
+   /* Terminación de la tarea */
+   TerminateTask();
+}
+
+/** @brief Tarea que envia la cadena
+ **
+ ** Esta tarea se activa cada vez que presiona la tecla uno y encola las dos
+ ** cadenas como un solo mensaje, que se transmite sin pausas entre ambas.
+ ** El led amarillo permanece encendido hasta que se completa la transmisión,
+ ** que la tarea no espera sino que la rutina de servicio lo apaga con un
+ ** aviso. Si la cola no tiene lugar el aviso vuelve a activar la tarea cuando
+ ** se vacia, por lo que es una tarea básica sin pila propia entre envios.
+ ** Solo se registra un aviso de reintento a la vez, para que junto con las
+ ** activaciones de la tecla no se supere el limite de activaciones de la
+ ** tarea, y si no se puede registrar ningún aviso el mensaje se descarta.
+ */
+TASK(Enviar) {
+   static const fragmento_t mensaje[] = {
+      { LITERAL("Estan ahí mis vidaas? ") },
+      { LITERAL("Me oyen? Me escuchan? Me sienten?\r\n") },
+   };
+
+   Led_On(YELLOW_LED);
+   if (EnviarFragmentos(mensaje, sizeof(mensaje) / sizeof(mensaje[0]))) {
+      if (!AvisarTransmision(INVALID_TASK, ApagarIndicador, NULL)) {
+         Led_Off(YELLOW_LED);
+      }
+   } else if (!reintento_envio) {
+      /* Si la cola no tiene lugar se vuelve a intentar cuando se vacie, la
+         marca se pone antes porque el aviso se puede cumplir enseguida */
+      reintento_envio = TRUE;
+      if (!AvisarTransmision(Enviar, ReintentarEnvio, NULL)) {
+         reintento_envio = FALSE;
+         Led_Off(YELLOW_LED);
+      }
+   }
+
+   /* Terminación de la tarea */
+   TerminateTask();
+}
+
+/** @brief Tarea que procesa las tramas recibidas
+ **
+ ** Esta tarea se activa durante la configuración y espera los eventos de
+ ** recepción de todos los puertos, que cada rutina de servicio envia solo
+ ** cuando se completa una trama. Las tramas de la consola con el nombre de un
+ ** comando habilitado se responden con su informe y las demas se devuelven
+ ** como una linea por el mismo puerto. Con @ref SERIAL_PAQUETES las tramas de
+ ** los otros puertos se decodifican como paquetes.
+ */
+TASK(Recepcion) {
+   uint8_t trama[SERIAL_RX_TRAMA_MAXIMA];
+   uint32_t cantidad;
+   EventMaskType eventos = 0;
+   uint8_t indice;
+
+   for (indice = 0; indice < PUERTOS_CANTIDAD; indice++) {
+      eventos |= puertos[indice].config->evento;
+   }
+
+   while (TRUE) {
+      WaitEvent(eventos);
+      ClearEvent(eventos);
+
+      /* Se procesan todas las tramas porque los eventos no se acumulan */
+      for (indice = 0; indice < PUERTOS_CANTIDAD; indice++) {
+         cantidad = RecibirPuerto(indice, trama, sizeof(trama));
+         while (cantidad > 0) {
+            if ((indice == PUERTO_CONSOLA) && EjecutarComando(trama, cantidad)) {
+               /* Los comandos se responden en lugar del eco */
+#if SERIAL_PAQUETES
+            } else if (indice != PUERTO_CONSOLA) {
+               /* Los datos de los paquetes validos se devuelven en otro paquete */
+               cantidad = PaqueteDecodificar(trama, cantidad);
+               if (cantidad > 0) {
+                  EnviarPaquete(indice, trama, cantidad);
+               }
+#endif
+            } else if (ReservarPuerto(indice, cantidad + 2)) {
+               EscribirReserva(trama, cantidad);
+               EscribirReserva("\r\n", 2);
+               ConfirmarReserva();
+            }
+            cantidad = RecibirPuerto(indice, trama, sizeof(trama));
+         }
+      }
+   }
+}
+
+/** @brief Rutina de servicio interrupcion serial
+ **
+ ** Esta rutina se activa cuando la FIFO de recepción alcanza su nivel de
+ ** disparo o pasa el tiempo de espera entre caracteres, y cada vez que se
+ ** vacia la FIFO de transmisión. Notifica con un evento a la tarea Recepcion
+ ** solo cuando se completa una trama, envia el siguiente bloque de la cola de
+ ** transmisión y notifica a las tareas cuyos datos ya se transmitieron. Con
+ ** @ref SERIAL_MEDICION registra la duración de cada atención.
+ */
+EN_RAM ISR(EventoSerial) {
+   AtenderPuerto(&puertos[PUERTO_CONSOLA]);
+}
+
+/** @brief Rutina de servicio interrupcion del puerto RS-485
+ **
+ ** Igual que la rutina de la consola pero para la uart del puerto RS-485. Si
+ ** el puerto no esta habilitado no hace nada.
+ */
+EN_RAM ISR(EventoRs485) {
+#if SERIAL_RS485
+   AtenderPuerto(&puertos[PUERTO_RS485]);
+#endif
+}
+
+/** @brief Rutina de servicio interrupcion del puerto RS-232
+ **
+ ** Igual que la rutina de la consola pero para la uart del puerto RS-232. Si
+ ** el puerto no esta habilitado no hace nada.
+ */
+EN_RAM ISR(EventoRs232) {
+#if SERIAL_RS232
+   AtenderPuerto(&puertos[PUERTO_RS232]);
+#endif
+}
+
+/** @brief Rutina de servicio del aviso del coprocesador
+ **
+ ** El Cortex-M0 la activa con la instrucción SEV despues de retirar datos de
+ ** las colas de la consola o de recibir caracteres, por lo que notifica a las
+ ** tareas que esperan la transmisión y arma las tramas recibidas. Si el
+ ** coprocesador no esta habilitado no hace nada.
+ */
+EN_RAM ISR(EventoCoprocesador) {
+#if SERIAL_COPROCESADOR
+   puerto_t * puerto = &puertos[PUERTO_CONSOLA];
+   TRAZA_INICIO(entrada);
+
+   LPC_CREG->M0APPTXEVENT = 0;
+   ESTADISTICA_SUMAR(puerto, interrupciones, 1);
+   if (RecibirCoprocesador(puerto)) {
+      SetEvent(puerto->config->tarea, puerto->config->evento);
+   }
+   NotificarEsperas(puerto);
+   TRAZA_INTERRUPCION_FIN(puerto->config->traza, entrada);
+#endif
+}
+
+/** @brief Rutina de servicio interrupcion del DMA
+ **
+ ** Esta rutina se activa cuando el canal del GPDMA termina de entregar a la
+ ** uart un bloque de la cola de transmisión, notifica con un evento a las
+ ** tareas cuyos datos ya se transmitieron y si quedan datos en la cola
+ ** continua la transmisión. Si la transmisión por DMA no esta habilitada no
+ ** hace nada.
+ */
+EN_RAM ISR(EventoDma) {
+#if SERIAL_DMA
+   puerto_t * puerto;
+   uint8_t indice;
+   MEDICION_INICIO(inicio);
+   TRAZA_INICIO(entrada);
+
+   /* Todos los canales comparten la interrupción, por lo que se revisan los
+      de todos los puertos con una transferencia en curso */
+   for (indice = 0; indice < PUERTOS_CANTIDAD; indice++) {
+      puerto = &puertos[indice];
+      if ((puerto->enviados_dma != 0)
+         && (Chip_GPDMA_Interrupt(LPC_GPDMA, puerto->canal_dma) == SUCCESS)) {
+         DescartarTramo(puerto, puerto->enviados_dma);
+         puerto->enviados_dma = 0;
+         NotificarEsperas(puerto);
+
+         if (DatosPendientes(puerto) > 0) {
+            /* Los datos encolados durante la transferencia se envian despues */
+            IniciarTransmision(puerto);
+         }
+      }
+   }
+   /* Todas las rutinas tienen la misma prioridad y comparten la medición */
+   MEDICION_REGISTRAR(&duracion_interrupcion, inicio);
+   TRAZA_INTERRUPCION_FIN(TRAZA_EVENTO_DMA, entrada);
+#endif
+}
+
+/** @brief Rutina de la alarma que marca el paso de cada segundo
+ **
+ ** La alarma IncrementarSegundo aumenta cada mil ticks el contador Segundero
+ ** y esta rutina se ejecuta con cada incremento del mismo, sin activar una
+ ** tarea. Actualiza el tiempo desde el arranque y hace parpadear el led azul.
+ */
+ALARMCALLBACK(PasoSegundo) {
+   TiempoPasoSegundo();
+   Led_Toggle(RGB_B_LED);
+}
+
+/** @brief Rutina de la alarma que cierra la ventana de agrupamiento
+ **
+ ** Inicia la transmisión de todos los puertos con datos esperando la
+ ** ventana. Si no se agrupan los mensajes la alarma nunca se arranca.
+ */
+ALARMCALLBACK(Agrupar) {
+#if SERIAL_AGRUPAR_VENTANA
+   uint8_t indice;
+
+   ventana_activa = FALSE;
+   for (indice = 0; indice < PUERTOS_CANTIDAD; indice++) {
+      if (puertos[indice].agrupando) {
+         puertos[indice].agrupando = FALSE;
+         IniciarTransmision(&puertos[indice]);
+      }
+   }
+#endif
+}
+
+/** @brief Rutina de servicio de la interrupción del pin de la tecla 1
+ **
+ ** Las rutinas de las teclas se activan con cada flanco de su pin cuando el
+ ** teclado se lee por interrupciones. En caso contrario no hacen nada.
+ */
+ISR(EventoTecla1) {
+#if TECLADO_INTERRUPCION
+   AtenderTecla(0);
+#endif
+}
+
+/** @brief Rutina de servicio de la interrupción del pin de la tecla 2
+ */
+ISR(EventoTecla2) {
+#if TECLADO_INTERRUPCION
+   AtenderTecla(1);
+#endif
+}
+
+/** @brief Rutina de servicio de la interrupción del pin de la tecla 3
+ */
+ISR(EventoTecla3) {
+#if TECLADO_INTERRUPCION
+   AtenderTecla(2);
+#endif
+}
+
+/** @brief Rutina de servicio de la interrupción del pin de la tecla 4
+ */
+ISR(EventoTecla4) {
+#if TECLADO_INTERRUPCION
+   AtenderTecla(3);
+#endif
+}
+
+/** @brief Tarea ociosa del sistema
+ **
+ ** Esta tarea tiene la menor prioridad del sistema, la activa la tarea de
+ ** configuración y nunca termina, por lo que reemplaza al ciclo ocioso del
+ ** sistema operativo. Entrega a la cola de transmisión los registros de la
+ ** traza y de la bitacora, si estan habilitadas, y cuando no tiene nada que
+ ** enviar detiene el procesador hasta la siguiente interrupción.
+ */
+TASK(Ocioso) {
+   bool ocupada;
+
+   while (TRUE) {
+      ocupada = FALSE;
+#if SERIAL_TRAZA
+      ocupada = TrazaEnviar();
+#endif
+#if SERIAL_BITACORA
+      if (BitacoraEnviar()) {
+         ocupada = TRUE;
+      }
+#endif
+
+#if OCIOSO_BAJO_CONSUMO
+      /* Si una interrupción deja trabajo justo antes de dormir se atiende
+         en la siguiente, a mas tardar en el proximo tick */
+      if (!ocupada) {
+         __WFI();
+      }
+#else
+      /* Sin bajo consumo la tarea sigue consultando aunque no haya trabajo */
+      (void) ocupada;
+#endif
+   }
+}
+
+/** @brief Función que se ejecuta antes de cada tarea
+ **
+ ** Esta función es llamada desde el sistema operativo cada vez que una tarea
+ ** pasa al estado de ejecución y registra su entrada en la traza.
+ */
+void PreTaskHook(void) {
+#if SERIAL_TRAZA
+   TrazaTarea(TRAZA_ENTRADA);
+#endif
+}
+
+/** @brief Función que se ejecuta despues de cada tarea
+ **
+ ** Esta función es llamada desde el sistema operativo cada vez que una tarea
+ ** deja el estado de ejecución, porque termina, espera un evento o es
+ ** desplazada por otra de mayor prioridad, y registra su salida en la traza.
+ */
+void PostTaskHook(void) {
+#if SERIAL_TRAZA
+   TrazaTarea(TRAZA_SALIDA);
+#endif
+}
+
+/** @brief Función para interceptar errores
+ **
+ ** Esta función es llamada desde el sistema operativo si una función de 
+ ** interface (API) devuelve un error. Esta definida para facilitar la
+ ** depuración y detiene el sistema operativo llamando a la función
+ ** ShutdownOs.
+ **
+ ** Los valores:
+ **    OSErrorGetServiceId
+ **    OSErrorGetParam1
+ **    OSErrorGetParam2
+ **    OSErrorGetParam3
+ **    OSErrorGetRet
+ ** brindan acceso a la interface que produjo el error, los parametros de 
+ ** entrada y el valor de retorno de la misma.
+ **
+ ** Para mas detalles consultar la especificación de OSEK:
+ ** http://portal.osek-vdx.org/files/pdf/specs/os223.pdf
+ */
+void ErrorHook(void) {
+   Led_On(RED_LED);
+   ShutdownOS(0);
+}
+
+/** @brief Función principal del programa
+ **
+ ** @returns 0 La función nunca debería terminar
+ **
+ ** \remark En un sistema embebido la función main() nunca debe terminar.
+ **         El valor de retorno 0 es para evitar un error en el compilador.
+ */
+int main(void) {
+
+#if SERIAL_PILAS
+   /* Las pilas se pintan antes de que las use alguna tarea */
+   PilaPintar();
+#endif
+
+   /* Inicio del sistema operatvio en el modo de aplicación Normal */
+   StartOS(Normal);
+
+   /* StartOs solo retorna si se detiene el sistema operativo */
+   while(1);
+
+   /* El valor de retorno es solo para evitar errores en el compilador*/
+   return 0;
+}
+
+/* === Ciere de documentacion ============================================== */
+
+/** @} Final de la definición del modulo para doxygen */
+
@@ -0,0 +1,115 @@
+/* Copyright 2026, Gustavo Sosa - UTN FRT
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file tiempo.c
+ **
+ ** @brief Tiempo transcurrido desde el arranque del sistema
+ **
+ ** Implementación de la cuenta de segundos. La rutina de la alarma guarda junto
+ ** con cada segundo el valor del contador de ciclos, y los lectores repiten la
+ ** lectura si la interrumpe el paso de un segundo.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2026.10.14 | gsosa       | Version inicial del archivo             |
+ **
+ ** @addtogroup ejemplos
+ ** @{
+ */
+
+/* === Inclusiones de cabeceras ============================================ */
+#include "tiempo.h"
+#include "medicion.h"
+#include "chip.h"
+
+/* === Definicion y Macros ================================================= */
+
+/* === Declaraciones de tipos de datos internos ============================ */
+
+/* === Declaraciones de funciones internas ================================= */
+
+/* === Definiciones de variables internas ================================== */
+
+//! Segundos transcurridos desde el arranque
+volatile uint32_t segundos;
+
+//! Valor del contador de ciclos en el ultimo paso de segundo
+volatile uint32_t inicio_segundo;
+
+/* === Definiciones de variables externas ================================== */
+
+/* === Definiciones de funciones internas ================================== */
+
+/* === Definiciones de funciones externas ================================== */
+
+void TiempoIniciar(void) {
+   MedicionIniciar();
+   segundos = 0;
+   inicio_segundo = MedicionMarca();
+}
+
+void TiempoPasoSegundo(void) {
+   inicio_segundo = MedicionMarca();
+   __DMB();
+   segundos++;
+}
+
+uint32_t TiempoSegundos(void) {
+   return (segundos);
+}
+
+uint32_t TiempoMilisegundos(void) {
+   tiempo_t tiempo;
+
+   TiempoLeer(&tiempo);
+   return (tiempo.segundos * 1000 + tiempo.microsegundos / 1000);
+}
+
+void TiempoLeer(tiempo_t * tiempo) {
+   uint32_t ciclos;
+
+   do {
+      tiempo->segundos = segundos;
+      __DMB();
+      ciclos = MedicionMarca() - inicio_segundo;
+      __DMB();
+   } while (tiempo->segundos != segundos);
+
+   /* Si la alarma se atrasa la fracción no debe llegar al segundo siguiente */
+   tiempo->microsegundos = ciclos / (SystemCoreClock / 1000000);
+   if (tiempo->microsegundos > 999999) {
+      tiempo->microsegundos = 999999;
+   }
+}
+
+/* === Ciere de documentacion ============================================== */
+
+/** @} Final de la definición del modulo para doxygen */
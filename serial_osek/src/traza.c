@@ -0,0 +1,169 @@
+/* Copyright 2026, Gustavo Sosa - UTN FRT
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file traza.c
+ **
+ ** @brief Traza binaria de la ejecución de las tareas
+ **
+ ** Implementación de la cola de registros de la traza. Los productores son los
+ ** ganchos del sistema operativo y las rutinas de servicio, que escriben con las
+ ** interrupciones suspendidas, y el unico consumidor es la tarea ociosa.
+ **
+ ** | RV | YYYY.MM.DD | Autor       | Descripción de los cambios              |
+ ** |----|------------|-------------|-----------------------------------------|
+ ** |  1 | 2026.10.14 | gsosa       | Version inicial del archivo             |
+ **
+ ** @addtogroup ejemplos
+ ** @{
+ */
+
+/* === Inclusiones de cabeceras ============================================ */
+#include "traza.h"
+#include "cola.h"
+#include "serial.h"
+#include "chip.h"
+#include "os.h"
+
+/* === Definicion y Macros ================================================= */
+
+/** @brief Tamaño de la cola de registros de la traza
+ **
+ ** Debe ser una potencia de dos y por lo tanto un multiplo del tamaño de un
+ ** registro, asi ningun registro queda partido al final de la cola.
+ */
+#ifndef TRAZA_LONGITUD
+   #define TRAZA_LONGITUD     512
+#endif
+
+#if !COLA_TAMANIO_VALIDO(TRAZA_LONGITUD)
+   #error "TRAZA_LONGITUD debe ser una potencia de dos"
+#endif
+
+/** @brief Cantidad maxima de bytes de la traza que se encolan por vez
+ **
+ ** Limita el lugar que ocupa la traza en la cola de transmisión para que los
+ ** mensajes de las tareas no tengan que esperar mucho por lugar.
+ */
+#ifndef TRAZA_ENVIO_MAXIMO
+   #define TRAZA_ENVIO_MAXIMO 64
+#endif
+
+#if (TRAZA_ENVIO_MAXIMO % 8) != 0
+   #error "TRAZA_ENVIO_MAXIMO debe ser un multiplo del tamaño de un registro"
+#endif
+
+/* === Declaraciones de tipos de datos internos ============================ */
+
+/* === Declaraciones de funciones internas ================================= */
+
+/* === Definiciones de variables internas ================================== */
+
+//! Memoria para los registros pendientes de envio
+uint8_t buffer_traza[TRAZA_LONGITUD];
+
+//! Cola con los registros pendientes de envio
+cola_t traza;
+
+//! Cantidad de registros descartados desde el ultimo registro encolado
+uint32_t perdidos;
+
+/* === Definiciones de variables externas ================================== */
+
+/* === Definiciones de funciones internas ================================== */
+
+/* === Definiciones de funciones externas ================================== */
+
+void TrazaIniciar(void) {
+   ColaIniciar(&traza, buffer_traza, sizeof(buffer_traza));
+   perdidos = 0;
+   MedicionIniciar();
+}
+
+void TrazaRegistrar(uint8_t tipo, uint8_t identificador, uint32_t duracion, uint32_t marca) {
+   registro_traza_t registro[2];
+   uint8_t cantidad = 0;
+
+   /* Los ganchos pueden ser interrumpidos por las rutinas de servicio, que
+      tambien agregan registros */
+   SuspendAllInterrupts();
+   if (perdidos > 0) {
+      registro[0].tipo = TRAZA_PERDIDOS;
+      registro[0].identificador = 0;
+      registro[0].duracion = (perdidos > UINT16_MAX) ? UINT16_MAX : perdidos;
+      registro[0].marca = marca;
+      cantidad = 1;
+   }
+   registro[cantidad].tipo = tipo;
+   registro[cantidad].identificador = identificador;
+   registro[cantidad].duracion = (duracion > UINT16_MAX) ? UINT16_MAX : duracion;
+   registro[cantidad].marca = marca;
+   cantidad++;
+
+   if (ColaLibre(&traza) >= cantidad * sizeof(registro_traza_t)) {
+      ColaCopiar(&traza, 0, registro, cantidad * sizeof(registro_traza_t));
+      ColaPublicar(&traza, cantidad * sizeof(registro_traza_t));
+      perdidos = 0;
+   } else {
+      perdidos++;
+   }
+   ResumeAllInterrupts();
+}
+
+void TrazaTarea(uint8_t tipo) {
+   TaskType tarea;
+
+   GetTaskID(&tarea);
+   TrazaRegistrar(tipo, tarea, 0, MedicionMarca());
+}
+
+void TrazaInterrupcion(uint8_t rutina, uint32_t marca) {
+   TrazaRegistrar(TRAZA_INTERRUPCION, rutina, MedicionMarca() - marca, marca);
+}
+
+bool TrazaEnviar(void) {
+   const uint8_t * datos;
+   uint32_t cantidad;
+   bool enviada = FALSE;
+
+   cantidad = ColaBloque(&traza, &datos);
+   if (cantidad > TRAZA_ENVIO_MAXIMO) {
+      cantidad = TRAZA_ENVIO_MAXIMO;
+   }
+   if ((cantidad > 0) && EnviarBloque(datos, cantidad)) {
+      ColaDescartar(&traza, cantidad);
+      enviada = TRUE;
+   }
+   return (enviada);
+}
+
+/* === Ciere de documentacion ============================================== */
+
+/** @} Final de la definición del modulo para doxygen */
@@ -0,0 +1,250 @@
+#!/usr/bin/env python3
+# Copyright 2026, Gustavo Sosa - UTN FRT
+#
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice,
+#    this list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived from this
+#    software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+# LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+# CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+# SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+# INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+# CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+
+"""Decodificador de la bitacora binaria de serial_osek
+
+Lee una captura binaria de la uart de depuración, obtenida por ejemplo con
+`cat /dev/ttyUSB1 > captura.bin`, y reemplaza cada registro de la bitacora por
+el texto del mensaje con sus argumentos. Los textos que envia la aplicación
+se muestran sin cambios y los registros de la traza se descartan.
+
+La tabla de cadenas se arma con las llamadas a BITACORA de los fuentes y el
+numero de archivo de cada uno, definido con BITACORA_ARCHIVO. Con la opción
+--generar la tabla se guarda en un archivo json durante la compilación, para
+decodificar luego capturas de ese programa aunque los fuentes cambien.
+
+Los registros tienen una cabecera de cuatro bytes con el formato de
+registro_bitacora_t en bitacora.h, tipo, cantidad de argumentos e
+identificador, seguida por los argumentos en palabras de 32 bits en little
+endian. El identificador tiene el numero de archivo en los cuatro bits mas
+significativos y el numero de linea en el resto.
+
+    python3 bitacora.py captura.bin [--fuentes ../src] [--tabla tabla.json] [--resumen]
+    python3 bitacora.py --generar tabla.json [--fuentes ../src]
+"""
+
+import argparse
+import glob
+import json
+import os
+import re
+import struct
+import sys
+
+TRAZA_ENTRADA = 0xA0
+TRAZA_PERDIDOS = 0xA3
+TRAZA_REGISTRO = 8
+
+BITACORA_REGISTRO = 0xA4
+BITACORA_PERDIDOS = 0
+BITACORA_ARGUMENTOS_MAXIMO = 4
+BITS_LINEA = 12
+
+CABECERA = struct.Struct("<BBH")
+
+ESCAPES = {"n": "\n", "r": "\r", "t": "\t", "0": "\0", "\\": "\\", "\"": "\"", "'": "'"}
+
+LLAMADA = re.compile(r"(?<![\w#])BITACORA\s*\(\s*((?:\"(?:[^\"\\\n]|\\.)*\"\s*)+)")
+LITERAL = re.compile(r"\"((?:[^\"\\\n]|\\.)*)\"")
+ARCHIVO = re.compile(r"^\s*#\s*define\s+BITACORA_ARCHIVO\s+(\d+)", re.M)
+ESPECIFICACION = re.compile(r"%(0?)(\d*)(?:\.(\d*))?(.?)", re.S)
+
+
+def desescapar(texto):
+    """Convierte las secuencias de escape de un literal de C"""
+    def reemplazo(coincidencia):
+        secuencia = coincidencia.group(1)
+        if secuencia[0] == "x":
+            return chr(int(secuencia[1:], 16))
+        return ESCAPES.get(secuencia, secuencia)
+    return re.sub(r"\\(x[0-9a-fA-F]{1,2}|.)", reemplazo, texto)
+
+
+def cierre(texto, inicio):
+    """Devuelve la posición del parentesis que cierra la llamada"""
+    nivel = 0
+    indice = inicio
+    while indice < len(texto):
+        if texto[indice] == "\"":
+            indice = LITERAL.match(texto, indice).end() - 1
+        elif texto[indice] == "(":
+            nivel += 1
+        elif texto[indice] == ")":
+            nivel -= 1
+            if nivel == 0:
+                return indice
+        indice += 1
+    return inicio
+
+
+def generar_tabla(fuentes):
+    """Arma la tabla de cadenas con los identificadores de cada llamada"""
+    tabla = {}
+    archivos = {}
+    for ruta in sorted(glob.glob(os.path.join(fuentes, "*.c"))):
+        with open(ruta, encoding="utf-8", errors="replace") as archivo:
+            texto = archivo.read()
+        numero = ARCHIVO.search(texto)
+        llamadas = list(LLAMADA.finditer(texto))
+        if not llamadas:
+            continue
+        if numero is None:
+            sys.exit("%s usa BITACORA sin definir BITACORA_ARCHIVO" % ruta)
+        numero = int(numero.group(1))
+        if not 1 <= numero < 16 or numero in archivos:
+            sys.exit("%s: BITACORA_ARCHIVO %u invalido o repetido" % (ruta, numero))
+        archivos[numero] = os.path.basename(ruta)
+        for llamada in llamadas:
+            formato = "".join(desescapar(parte) for parte in LITERAL.findall(llamada.group(1)))
+            # Segun el compilador __LINE__ es la linea del nombre de la
+            # macro o la del parentesis que la cierra
+            lineas = {texto.count("\n", 0, llamada.start()) + 1,
+                      texto.count("\n", 0, cierre(texto, llamada.start())) + 1}
+            for linea in lineas:
+                if linea >= 1 << BITS_LINEA:
+                    sys.exit("%s:%u: la linea no entra en el identificador" % (ruta, linea))
+                tabla[str((numero << BITS_LINEA) | linea)] = {
+                    "archivo": archivos[numero], "linea": linea, "formato": formato}
+    return tabla
+
+
+def entero(valor):
+    return valor - (1 << 32) if valor & 0x80000000 else valor
+
+
+def convertir(formato, argumentos):
+    """Formatea un mensaje como EnviarFormato en formato.c"""
+    argumentos = list(argumentos)
+
+    def especificacion(coincidencia):
+        relleno, ancho, decimales, conversion = coincidencia.groups()
+        ancho = min(int(ancho or 0), 16)
+        decimales = min(int(decimales or 0), 9)
+        if conversion in "diuxXqc" and conversion and not argumentos:
+            return "<?>"
+        if conversion in ("d", "i"):
+            texto = "%d" % entero(argumentos.pop(0))
+        elif conversion == "u":
+            texto = "%u" % argumentos.pop(0)
+        elif conversion == "x":
+            texto = "%x" % argumentos.pop(0)
+        elif conversion == "X":
+            texto = "%X" % argumentos.pop(0)
+        elif conversion == "q":
+            valor = entero(argumentos.pop(0))
+            magnitud = "%0*u" % (decimales + 1, abs(valor))
+            if decimales:
+                magnitud = magnitud[:-decimales] + "." + magnitud[-decimales:]
+            texto = ("-" if valor < 0 else "") + magnitud
+        elif conversion == "c":
+            return chr(argumentos.pop(0) & 0xFF)
+        else:
+            return conversion
+        if relleno and texto.startswith("-"):
+            return "-" + texto[1:].rjust(ancho - 1, "0")
+        return texto.rjust(ancho, relleno or " ")
+
+    return ESPECIFICACION.sub(especificacion, formato)
+
+
+def decodificar(datos, tabla):
+    """Devuelve el texto de la captura, los bytes de los registros y los de sus textos"""
+    salida = []
+    binarios = 0
+    equivalentes = 0
+    indice = 0
+    while indice < len(datos):
+        cantidad = datos[indice + 1] if indice + 1 < len(datos) else 0xFF
+        longitud = CABECERA.size + 4 * cantidad
+        if datos[indice] == BITACORA_REGISTRO and cantidad <= BITACORA_ARGUMENTOS_MAXIMO \
+                and indice + longitud <= len(datos):
+            _, _, identificador = CABECERA.unpack_from(datos, indice)
+            argumentos = struct.unpack_from("<%uI" % cantidad, datos, indice + CABECERA.size)
+            if identificador == BITACORA_PERDIDOS:
+                salida.append("[%u mensajes perdidos]\n" % (argumentos[0] if argumentos else 0))
+            elif str(identificador) in tabla:
+                salida.append(convertir(tabla[str(identificador)]["formato"], argumentos))
+            else:
+                salida.append("[archivo %u linea %u: %s]\n" % (
+                    identificador >> BITS_LINEA, identificador & ((1 << BITS_LINEA) - 1),
+                    " ".join("0x%08X" % argumento for argumento in argumentos)))
+            binarios += longitud
+            equivalentes += len(salida[-1].encode("utf-8"))
+            indice += longitud
+        elif TRAZA_ENTRADA <= datos[indice] <= TRAZA_PERDIDOS \
+                and indice + TRAZA_REGISTRO <= len(datos):
+            indice += TRAZA_REGISTRO
+        else:
+            salida.append(chr(datos[indice]))
+            indice += 1
+    return "".join(salida), binarios, equivalentes
+
+
+def main():
+    carpeta = os.path.dirname(os.path.abspath(__file__))
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("captura", nargs="?", help="archivo con los bytes recibidos, - para la entrada estandar")
+    parser.add_argument("--fuentes", default=os.path.join(carpeta, "..", "src"),
+                        help="carpeta con los fuentes que usan BITACORA")
+    parser.add_argument("--tabla", help="tabla de cadenas generada con --generar")
+    parser.add_argument("--generar", metavar="TABLA", help="guarda la tabla de cadenas y termina")
+    parser.add_argument("--resumen", action="store_true",
+                        help="informa los bytes de los registros y de los textos equivalentes")
+    argumentos = parser.parse_args()
+
+    if argumentos.generar:
+        with open(argumentos.generar, "w", encoding="utf-8") as archivo:
+            json.dump(generar_tabla(argumentos.fuentes), archivo, indent=1, sort_keys=True)
+        return
+    if argumentos.captura is None:
+        parser.error("falta la captura")
+
+    if argumentos.tabla:
+        with open(argumentos.tabla, encoding="utf-8") as archivo:
+            tabla = json.load(archivo)
+    else:
+        tabla = generar_tabla(argumentos.fuentes)
+
+    if argumentos.captura == "-":
+        datos = sys.stdin.buffer.read()
+    else:
+        with open(argumentos.captura, "rb") as archivo:
+            datos = archivo.read()
+
+    texto, binarios, equivalentes = decodificar(datos, tabla)
+    sys.stdout.write(texto)
+    if argumentos.resumen:
+        sys.stderr.write("Captura de %u bytes, %u de registros de la bitacora que como texto"
+                         " ocupan %u bytes\n" % (len(datos), binarios, equivalentes))
+
+
+if __name__ == "__main__":
+    main()
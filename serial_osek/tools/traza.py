@@ -0,0 +1,192 @@
+#!/usr/bin/env python3
+# Copyright 2026, Gustavo Sosa - UTN FRT
+#
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice,
+#    this list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived from this
+#    software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+# LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+# CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+# SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+# INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+# CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+
+"""Decodificador de la traza de ejecución de serial_osek
+
+Lee una captura binaria de la uart de depuración, obtenida por ejemplo con
+`cat /dev/ttyUSB1 > captura.bin`, separa los registros de la traza de los
+textos que envia la aplicación e informa el tiempo de procesador de cada tarea
+y de cada rutina de servicio. Los registros de la bitacora se descartan.
+
+Los registros tienen ocho bytes en little endian con el formato de
+registro_traza_t en traza.h: tipo, identificador, duración y marca. Los
+identificadores de las tareas se asignan en el orden en que se declaran en el
+archivo OIL.
+
+    python3 traza.py captura.bin [--oil ../etc/serial_osek.oil] [--eventos]
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+TRAZA_ENTRADA = 0xA0
+TRAZA_SALIDA = 0xA1
+TRAZA_INTERRUPCION = 0xA2
+TRAZA_PERDIDOS = 0xA3
+
+REGISTRO = struct.Struct("<BBHI")
+
+# Registros de la bitacora, ver tools/bitacora.py
+BITACORA_REGISTRO = 0xA4
+BITACORA_ARGUMENTOS_MAXIMO = 4
+
+# Identificadores TRAZA_EVENTO_* de serial.c
+RUTINAS = ["EventoSerial", "EventoDma", "EventoRs485", "EventoRs232"]
+
+
+def leer_tareas(oil):
+    """Devuelve los nombres de las tareas en el orden del archivo OIL"""
+    with open(oil, encoding="utf-8", errors="replace") as archivo:
+        texto = re.sub(r"//.*|/\*.*?\*/", "", archivo.read(), flags=re.S)
+    return re.findall(r"\bTASK\s+(\w+)\s*\{", texto)
+
+
+def separar(datos):
+    """Separa la captura en registros de la traza y bytes de texto"""
+    registros = []
+    texto = bytearray()
+    indice = 0
+    while indice < len(datos):
+        if TRAZA_ENTRADA <= datos[indice] <= TRAZA_PERDIDOS \
+                and indice + REGISTRO.size <= len(datos):
+            registros.append(REGISTRO.unpack_from(datos, indice))
+            indice += REGISTRO.size
+        elif datos[indice] == BITACORA_REGISTRO and indice + 1 < len(datos) \
+                and datos[indice + 1] <= BITACORA_ARGUMENTOS_MAXIMO:
+            indice += 4 + 4 * datos[indice + 1]
+        else:
+            texto.append(datos[indice])
+            indice += 1
+    return registros, bytes(texto)
+
+
+def nombre(tabla, identificador):
+    if identificador < len(tabla):
+        return tabla[identificador]
+    return "#%u" % identificador
+
+
+def analizar(registros, tareas, frecuencia, eventos):
+    ciclos_tarea = {}
+    entradas = {}
+    ciclos_rutina = {}
+    maximo_rutina = {}
+    cuenta_rutina = {}
+    perdidos = 0
+    actual = None
+    desde = None
+    inicio = None
+    final = None
+
+    for tipo, identificador, duracion, marca in registros:
+        if inicio is None:
+            inicio = marca
+        final = marca
+        if eventos:
+            tiempo = ((marca - inicio) & 0xFFFFFFFF) * 1e6 / frecuencia
+            if tipo == TRAZA_INTERRUPCION:
+                detalle = "%s %u ciclos" % (nombre(RUTINAS, identificador), duracion)
+            elif tipo == TRAZA_PERDIDOS:
+                detalle = "%u registros perdidos" % duracion
+            else:
+                detalle = "%s %s" % ("entra" if tipo == TRAZA_ENTRADA else "sale",
+                                     nombre(tareas, identificador))
+            print("%12.1f us  %s" % (tiempo, detalle))
+
+        if tipo == TRAZA_ENTRADA:
+            actual = identificador
+            desde = marca
+            entradas[actual] = entradas.get(actual, 0) + 1
+        elif tipo == TRAZA_SALIDA:
+            if actual == identificador and desde is not None:
+                ciclos = (marca - desde) & 0xFFFFFFFF
+                ciclos_tarea[actual] = ciclos_tarea.get(actual, 0) + ciclos
+            actual = None
+        elif tipo == TRAZA_INTERRUPCION:
+            ciclos_rutina[identificador] = ciclos_rutina.get(identificador, 0) + duracion
+            cuenta_rutina[identificador] = cuenta_rutina.get(identificador, 0) + 1
+            maximo_rutina[identificador] = max(maximo_rutina.get(identificador, 0), duracion)
+            # La rutina interrumpió a la tarea en ejecución
+            if actual is not None:
+                ciclos_tarea[actual] = ciclos_tarea.get(actual, 0) - duracion
+        elif tipo == TRAZA_PERDIDOS:
+            perdidos += duracion
+            # Con registros perdidos no se sabe que tarea estaba en ejecución
+            actual = None
+
+    if inicio is None:
+        print("La captura no tiene registros de la traza")
+        return
+
+    total = max((final - inicio) & 0xFFFFFFFF, 1)
+    print("Duración de la traza: %u ciclos (%.3f ms)" % (total, total * 1e3 / frecuencia))
+    print("%-16s %10s %12s %7s" % ("Tarea", "Entradas", "Ciclos", "%"))
+    for tarea in sorted(ciclos_tarea, key=ciclos_tarea.get, reverse=True):
+        print("%-16s %10u %12u %6.2f%%" % (nombre(tareas, tarea), entradas.get(tarea, 0),
+                                           ciclos_tarea[tarea], 100.0 * ciclos_tarea[tarea] / total))
+    print("%-16s %10s %12s %7s %8s" % ("Rutina", "Llamadas", "Ciclos", "%", "Maximo"))
+    for rutina in sorted(ciclos_rutina):
+        print("%-16s %10u %12u %6.2f%% %8u" % (nombre(RUTINAS, rutina), cuenta_rutina[rutina],
+                                               ciclos_rutina[rutina], 100.0 * ciclos_rutina[rutina] / total,
+                                               maximo_rutina[rutina]))
+    if perdidos:
+        print("Registros perdidos: %u" % perdidos)
+
+
+def main():
+    carpeta = os.path.dirname(os.path.abspath(__file__))
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("captura", help="archivo con los bytes recibidos, - para la entrada estandar")
+    parser.add_argument("--oil", default=os.path.join(carpeta, "..", "etc", "serial_osek.oil"),
+                        help="archivo OIL con la declaración de las tareas")
+    parser.add_argument("--frecuencia", type=float, default=204e6,
+                        help="frecuencia del contador de ciclos en Hz")
+    parser.add_argument("--eventos", action="store_true", help="lista cada registro de la traza")
+    parser.add_argument("--texto", action="store_true", help="muestra los textos de la aplicación")
+    argumentos = parser.parse_args()
+
+    if argumentos.captura == "-":
+        datos = sys.stdin.buffer.read()
+    else:
+        with open(argumentos.captura, "rb") as archivo:
+            datos = archivo.read()
+
+    registros, texto = separar(datos)
+    if argumentos.texto:
+        sys.stdout.write(texto.decode("utf-8", errors="replace"))
+    analizar(registros, leer_tareas(argumentos.oil), argumentos.frecuencia, argumentos.eventos)
+
+
+if __name__ == "__main__":
+    main()